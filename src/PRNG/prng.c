@@ -1,6 +1,7 @@
 #include "prng.h"
 
 #include <assert.h>
+#include <errno.h>
 #include <string.h>
 #include <time.h>
 #include <stdlib.h>
@@ -9,42 +10,288 @@
 
 // Engine Implementations...
 
+// Single steps live in prng_inline.h, shared with the typed front end
 static uint32_t marsaglia_next(prng_state_t* s) {
-    uint32_t t = s->state.mwc.a * MWC_MULTIPLIER_A + (s->state.mwc.a >> 16);
-    s->state.mwc.a = t;
-    t = s->state.mwc.b * MWC_MULTIPLIER_B + (s->state.mwc.b >> 16);
-    s->state.mwc.b = t;
-    return (s->state.mwc.a << 16) + s->state.mwc.b;
+    return prng_mwc_next_u32(&s->state.mwc);
 }
 
 static uint32_t xorshift_next(prng_state_t* s) {
-    uint32_t t = s->state.xorshift.x[3];
-    t ^= t << XORSHIFT_SHIFT_1;
-    t ^= t >> XORSHIFT_SHIFT_2;
-    s->state.xorshift.x[3] = s->state.xorshift.x[2];
-    s->state.xorshift.x[2] = s->state.xorshift.x[1];
-    s->state.xorshift.x[1] = s->state.xorshift.x[0];
-    t ^= s->state.xorshift.x[0];
-    t ^= s->state.xorshift.x[0] >> XORSHIFT_SHIFT_3;
-    s->state.xorshift.x[0] = t;
-    return t;
+    return prng_xorshift_next_u32(&s->state.xorshift);
 }
 
 static uint32_t pcg32_next(prng_state_t* s) {
-    uint64_t oldstate = s->state.pcg.state;
-    s->state.pcg.state = oldstate * PCG_MULTIPLIER + PCG_INCREMENT;
-    uint32_t xorshifted = ((oldstate >> (64 - PCG_ROTATE_BITS)) ^ oldstate) >> PCG_XSHIFT_BITS;
-    uint32_t rot = oldstate >> PCG_ROTATE_BITS;
-    return (xorshifted >> rot) | (xorshifted << ((-rot) & PCG_OUTPUT_BITS));
+    return prng_pcg32_next_u32(&s->state.pcg);
+}
+
+static uint64_t splitmix_next64(prng_state_t* s) {
+    return prng_splitmix_next_u64(&s->state.splitmix);
 }
 
 static uint32_t splitmix_next(prng_state_t* s) {
-    uint64_t z = (s->state.splitmix += SPLITMIX_INCREMENT);
-    z = (z ^ (z >> SPLITMIX_SHIFT_1)) * SPLITMIX_MULT_1;
-    z = (z ^ (z >> SPLITMIX_SHIFT_2)) * SPLITMIX_MULT_2;
-    return z >> 32;
+    return prng_splitmix_next_u32(&s->state.splitmix);
+}
+
+static uint32_t xoshiro256ss_next(prng_state_t* s) {
+    return prng_xoshiro256ss_next_u32(&s->state.xoshiro256);
+}
+
+static uint64_t xoshiro256ss_next64(prng_state_t* s) {
+    return prng_xoshiro256ss_next_u64(&s->state.xoshiro256);
+}
+
+static uint32_t xoshiro256p_next(prng_state_t* s) {
+    return prng_xoshiro256p_next_u32(&s->state.xoshiro256);
+}
+
+static uint64_t xoshiro256p_next64(prng_state_t* s) {
+    return prng_xoshiro256p_next_u64(&s->state.xoshiro256);
+}
+
+static uint32_t wyrand_next(prng_state_t* s) {
+    return prng_wyrand_next_u32(&s->state.wyrand);
+}
+
+static uint64_t wyrand_next64(prng_state_t* s) {
+    return prng_wyrand_next_u64(&s->state.wyrand);
+}
+
+static uint32_t sfc64_next(prng_state_t* s) {
+    return prng_sfc64_next_u32(&s->state.sfc64);
+}
+
+static uint64_t sfc64_next64(prng_state_t* s) {
+    return prng_sfc64_next_u64(&s->state.sfc64);
 }
 
+// next = next * 1103515245 + 12345; return (next / 65536) % 32768
+static uint32_t c99_next(prng_state_t* s) {
+    s->state.c99_seed = s->state.c99_seed * C99_LCG_MULTIPLIER + C99_LCG_INCREMENT;
+    return (s->state.c99_seed >> C99_LCG_SHIFT) & C99_RAND_MAX;
+}
+
+// Multi-lane Xoshiro128+
+// One block advances every lane once. The lane loop has a compile-time trip
+// count and no cross-lane dependency, so it maps onto vector registers. The
+// bulk fill runs it on local copies of the state words: out cannot alias them,
+// which is what lets the compiler keep the lanes in registers.
+#define PRNG_LANES_STEP(L, s0, s1, s2, s3, out)                                \
+    for (unsigned l = 0; l < (L); l++) {                                       \
+        const uint32_t t = s1[l] << XOSHIRO_SHIFT;                             \
+        (out)[l] = s0[l] + s3[l];                                              \
+        s2[l] ^= s0[l];                                                        \
+        s3[l] ^= s1[l];                                                        \
+        s1[l] ^= s2[l];                                                        \
+        s0[l] ^= s3[l];                                                        \
+        s2[l] ^= t;                                                            \
+        s3[l] = (s3[l] << XOSHIRO_ROTATE) | (s3[l] >> (32 - XOSHIRO_ROTATE));  \
+    }
+
+#define PRNG_DEFINE_LANES(name, L)                                             \
+    static uint32_t name##_next(prng_state_t* st) {                            \
+        if (st->state.lanes.pos >= (L)) {                                      \
+            uint32_t (*s)[PRNG_LANES_MAX] = st->state.lanes.s;                 \
+            PRNG_LANES_STEP(L, s[0], s[1], s[2], s[3], st->state.lanes.out)    \
+            st->state.lanes.pos = 0;                                           \
+        }                                                                      \
+        return st->state.lanes.out[st->state.lanes.pos++];                     \
+    }                                                                          \
+    static void name##_fill_u32(prng_state_t* st, uint32_t* out, size_t count) { \
+        uint32_t s0[L], s1[L], s2[L], s3[L];                                   \
+        size_t i = 0;                                                          \
+        while (i < count && st->state.lanes.pos < (L)) { /* drain buffer */    \
+            out[i++] = st->state.lanes.out[st->state.lanes.pos++];             \
+        }                                                                      \
+        memcpy(s0, st->state.lanes.s[0], sizeof(s0));                         \
+        memcpy(s1, st->state.lanes.s[1], sizeof(s1));                         \
+        memcpy(s2, st->state.lanes.s[2], sizeof(s2));                         \
+        memcpy(s3, st->state.lanes.s[3], sizeof(s3));                         \
+        for (; i + (L) <= count; i += (L)) {                                   \
+            PRNG_LANES_STEP(L, s0, s1, s2, s3, out + i)                        \
+        }                                                                      \
+        if (i < count) { /* partial block: keep the rest buffered */           \
+            PRNG_LANES_STEP(L, s0, s1, s2, s3, st->state.lanes.out)            \
+            st->state.lanes.pos = 0;                                           \
+            while (i < count) {                                                \
+                out[i++] = st->state.lanes.out[st->state.lanes.pos++];         \
+            }                                                                  \
+        }                                                                      \
+        memcpy(st->state.lanes.s[0], s0, sizeof(s0));                          \
+        memcpy(st->state.lanes.s[1], s1, sizeof(s1));                          \
+        memcpy(st->state.lanes.s[2], s2, sizeof(s2));                          \
+        memcpy(st->state.lanes.s[3], s3, sizeof(s3));                          \
+    }
+
+PRNG_DEFINE_LANES(lanes4, 4)
+PRNG_DEFINE_LANES(lanes8, 8)
+
+static unsigned lanes_count(const prng_state_t* st) {
+    return st->engine == PRNG_XOSHIRO128P_X4 ? 4 : 8;
+}
+
+// Each lane gets 128 bits from a SplitMix64 sequence - never all zero
+static void lanes_seed(prng_state_t* st, uint64_t seed) {
+    prng_state_t sm;
+    sm.state.splitmix.x = seed;
+    for (unsigned l = 0; l < PRNG_LANES_MAX; l++) {
+        const uint64_t a = splitmix_next64(&sm);
+        const uint64_t b = splitmix_next64(&sm);
+        st->state.lanes.s[0][l] = (uint32_t)a;
+        st->state.lanes.s[1][l] = (uint32_t)(a >> 32);
+        st->state.lanes.s[2][l] = (uint32_t)b;
+        st->state.lanes.s[3][l] = (uint32_t)(b >> 32);
+        if ((a | b) == 0) st->state.lanes.s[0][l] = 1;
+    }
+    st->state.lanes.pos = lanes_count(st); // empty: next draw computes a block
+}
+
+// Philox4x32-10 (Salmon et al., Random123): each 128-bit counter value is
+// encrypted under the 64-bit key by ten multiply/xor rounds into one block of
+// four outputs. The state is just (key, counter), so any position is reachable
+// in O(1).
+static void philox_round(uint32_t ctr[4], const uint32_t key[2]) {
+    const uint64_t p0 = (uint64_t)PHILOX_M0 * ctr[0];
+    const uint64_t p1 = (uint64_t)PHILOX_M1 * ctr[2];
+    const uint32_t c1 = ctr[1], c3 = ctr[3];
+    ctr[0] = (uint32_t)(p1 >> 32) ^ c1 ^ key[0];
+    ctr[1] = (uint32_t)p1;
+    ctr[2] = (uint32_t)(p0 >> 32) ^ c3 ^ key[1];
+    ctr[3] = (uint32_t)p0;
+}
+
+uint32_t* prng_philox_block(const uint32_t key[2], const uint32_t counter[4], uint32_t out[4]) {
+    uint32_t k[2];
+    k[0] = key[0];
+    k[1] = key[1];
+    memcpy(out, counter, 4 * sizeof(uint32_t));
+    for (unsigned r = 0; r < PHILOX_ROUNDS; r++) {
+        if (r) {
+            k[0] += PHILOX_W0;
+            k[1] += PHILOX_W1;
+        }
+        philox_round(out, k);
+    }
+    return out;
+}
+
+// 128-bit counter += blocks * 2^(32 * word)
+static void philox_add(uint32_t ctr[4], unsigned word, uint64_t blocks) {
+    uint64_t carry = blocks;
+    for (unsigned w = word; w < 4 && carry; w++) {
+        const uint64_t sum = (uint64_t)ctr[w] + (uint32_t)carry;
+        ctr[w] = (uint32_t)sum;
+        carry = (carry >> 32) + (sum >> 32);
+    }
+}
+
+static uint32_t philox_next(prng_state_t* st) {
+    if (st->state.philox.pos >= PHILOX_BLOCK) {
+        prng_philox_block(st->state.philox.key, st->state.philox.ctr, st->state.philox.out);
+        philox_add(st->state.philox.ctr, 0, 1);
+        st->state.philox.pos = 0;
+    }
+    return st->state.philox.out[st->state.philox.pos++];
+}
+
+static void philox_fill_u32(prng_state_t* st, uint32_t* out, size_t count) {
+    size_t i = 0;
+    while (i < count && st->state.philox.pos < PHILOX_BLOCK) { // drain buffer
+        out[i++] = st->state.philox.out[st->state.philox.pos++];
+    }
+    for (; i + PHILOX_BLOCK <= count; i += PHILOX_BLOCK) {
+        prng_philox_block(st->state.philox.key, st->state.philox.ctr, out + i);
+        philox_add(st->state.philox.ctr, 0, 1);
+    }
+    while (i < count) {
+        out[i++] = philox_next(st);
+    }
+}
+
+// Bulk u64/double for the block engines (lanes, Philox) go through their u32 fill in chunks
+#define PRNG_FILL_CHUNK 64
+
+static void chunked_fill_u64(prng_state_t* st, void (*fill)(prng_state_t*, uint32_t*, size_t),
+                           uint64_t* out, size_t count) {
+    uint32_t chunk[PRNG_FILL_CHUNK];
+    while (count) {
+        const size_t n = count < PRNG_FILL_CHUNK / 2 ? count : PRNG_FILL_CHUNK / 2;
+        fill(st, chunk, 2 * n);
+        for (size_t i = 0; i < n; i++) {
+            out[i] = ((uint64_t)chunk[2 * i] << 32) | chunk[2 * i + 1];
+        }
+        out += n;
+        count -= n;
+    }
+}
+
+static void chunked_fill_double(prng_state_t* st, void (*fill)(prng_state_t*, uint32_t*, size_t),
+                              double* out, size_t count) {
+    uint32_t chunk[PRNG_FILL_CHUNK];
+    while (count) {
+        const size_t n = count < PRNG_FILL_CHUNK ? count : PRNG_FILL_CHUNK;
+        fill(st, chunk, n);
+        for (size_t i = 0; i < n; i++) {
+            out[i] = chunk[i] * FLOAT_INV_2POW32;
+        }
+        out += n;
+        count -= n;
+    }
+}
+
+// 64-bit output of the 32-bit engines: two draws, first one in the high half
+#define PRNG_DEFINE_NEXT64(name)                                   \
+    static uint64_t name##_next64(prng_state_t* s) {               \
+        const uint64_t hi = name##_next(s);                        \
+        return (hi << 32) | name##_next(s);                        \
+    }
+
+PRNG_DEFINE_NEXT64(marsaglia)
+PRNG_DEFINE_NEXT64(xorshift)
+PRNG_DEFINE_NEXT64(pcg32)
+
+// rand() only has 15 bits: five draws fill all 64 (the first one's top 11 bits drop out)
+static uint64_t c99_next64(prng_state_t* s) {
+    uint64_t r = 0;
+    for (unsigned i = 0; i < 5; i++) {
+        r = (r << C99_RAND_BITS) | c99_next(s);
+    }
+    return r;
+}
+
+// Bulk loops: the state is copied to a local so the compiler can keep it in
+// registers across the inlined step, and written back once at the end.
+#define PRNG_DEFINE_FILL(name)                                                 \
+    static void name##_fill_u32(prng_state_t* s, uint32_t* out, size_t count) { \
+        prng_state_t local = *s;                                                \
+        for (size_t i = 0; i < count; i++) {                                    \
+            out[i] = name##_next(&local);                                       \
+        }                                                                       \
+        *s = local;                                                             \
+    }                                                                           \
+    static void name##_fill_u64(prng_state_t* s, uint64_t* out, size_t count) { \
+        prng_state_t local = *s;                                                \
+        for (size_t i = 0; i < count; i++) {                                    \
+            out[i] = name##_next64(&local);                                     \
+        }                                                                       \
+        *s = local;                                                             \
+    }                                                                           \
+    static void name##_fill_double(prng_state_t* s, double* out, size_t count) { \
+        prng_state_t local = *s;                                                \
+        for (size_t i = 0; i < count; i++) {                                    \
+            out[i] = name##_next(&local) * FLOAT_INV_2POW32;                    \
+        }                                                                       \
+        *s = local;                                                             \
+    }
+
+PRNG_DEFINE_FILL(marsaglia)
+PRNG_DEFINE_FILL(xorshift)
+PRNG_DEFINE_FILL(c99)
+PRNG_DEFINE_FILL(pcg32)
+PRNG_DEFINE_FILL(splitmix)
+PRNG_DEFINE_FILL(xoshiro256ss)
+PRNG_DEFINE_FILL(xoshiro256p)
+PRNG_DEFINE_FILL(wyrand)
+PRNG_DEFINE_FILL(sfc64)
+
 // Interface implementation...
 
 /**
@@ -117,7 +364,7 @@ void prng_init(prng_state_t* state, prng_engine_t engine, uint64_t seed, int war
             break;
 
         case PRNG_C99:
-            if (seed) srand((unsigned)seed);
+            state->state.c99_seed = (unsigned)seed; // srand() takes an unsigned int
             break;
 
         case PRNG_PCG32:
@@ -126,7 +373,38 @@ void prng_init(prng_state_t* state, prng_engine_t engine, uint64_t seed, int war
             break;
 
         case PRNG_SPLITMIX:
-            state->state.splitmix = seed ? seed : MWC_DEFAULT_SEED;
+            state->state.splitmix.x = seed ? seed : MWC_DEFAULT_SEED;
+            break;
+
+        case PRNG_XOSHIRO128P_X4:
+        case PRNG_XOSHIRO128P_X8:
+            lanes_seed(state, seed);
+            break;
+
+        case PRNG_XOSHIRO256SS:
+        case PRNG_XOSHIRO256P: {
+            prng_splitmix_t sm = {seed};
+            for (int i = 0; i < 4; i++)
+                state->state.xoshiro256.s[i] = prng_splitmix_next_u64(&sm);
+            break; // SplitMix64 outputs are a bijection of distinct counters: never all zero
+        }
+
+        case PRNG_WYRAND:
+            state->state.wyrand.x = seed;
+            break;
+
+        case PRNG_SFC64:
+            state->state.sfc64.a = state->state.sfc64.b = state->state.sfc64.c = seed;
+            state->state.sfc64.counter = 1;
+            for (int i = 0; i < SFC64_WARMUP; i++)
+                prng_sfc64_next_u64(&state->state.sfc64);
+            break;
+
+        case PRNG_PHILOX4X32:
+            state->state.philox.key[0] = (uint32_t)seed;
+            state->state.philox.key[1] = (uint32_t)(seed >> 32);
+            memset(state->state.philox.ctr, 0, sizeof(state->state.philox.ctr));
+            state->state.philox.pos = PHILOX_BLOCK;
             break;
     }
 }
@@ -137,33 +415,670 @@ uint32_t prng_next_u32(prng_state_t* state) {
     switch(state->engine) {
         case PRNG_MARSAGLIA: return marsaglia_next(state);
         case PRNG_XORSHIFT:  return xorshift_next(state);
-        case PRNG_C99:       return rand();
+        case PRNG_C99:       return c99_next(state);
         case PRNG_PCG32:     return pcg32_next(state);
         case PRNG_SPLITMIX:  return splitmix_next(state);
+        case PRNG_XOSHIRO128P_X4: return lanes4_next(state);
+        case PRNG_XOSHIRO128P_X8: return lanes8_next(state);
+        case PRNG_PHILOX4X32: return philox_next(state);
+        case PRNG_XOSHIRO256SS: return xoshiro256ss_next(state);
+        case PRNG_XOSHIRO256P: return xoshiro256p_next(state);
+        case PRNG_WYRAND:    return wyrand_next(state);
+        case PRNG_SFC64:     return sfc64_next(state);
         default:             return 0;
     }
 }
 
+uint32_t* prng_fill_u32(prng_state_t* state, uint32_t* out, size_t count) {
+    assert(state != NULL);
+    assert(out != NULL || count == 0);
+
+    switch(state->engine) {
+        case PRNG_MARSAGLIA: marsaglia_fill_u32(state, out, count); break;
+        case PRNG_XORSHIFT:  xorshift_fill_u32(state, out, count);  break;
+        case PRNG_C99:       c99_fill_u32(state, out, count);       break;
+        case PRNG_PCG32:     pcg32_fill_u32(state, out, count);     break;
+        case PRNG_SPLITMIX:  splitmix_fill_u32(state, out, count);  break;
+        case PRNG_XOSHIRO128P_X4: lanes4_fill_u32(state, out, count); break;
+        case PRNG_XOSHIRO128P_X8: lanes8_fill_u32(state, out, count); break;
+        case PRNG_PHILOX4X32: philox_fill_u32(state, out, count);   break;
+        case PRNG_XOSHIRO256SS: xoshiro256ss_fill_u32(state, out, count); break;
+        case PRNG_XOSHIRO256P: xoshiro256p_fill_u32(state, out, count); break;
+        case PRNG_WYRAND:    wyrand_fill_u32(state, out, count);    break;
+        case PRNG_SFC64:     sfc64_fill_u32(state, out, count);     break;
+        default:             memset(out, 0, count * sizeof(*out));  break;
+    }
+    return out;
+}
+
+uint64_t* prng_fill_u64(prng_state_t* state, uint64_t* out, size_t count) {
+    assert(state != NULL);
+    assert(out != NULL || count == 0);
+
+    switch(state->engine) {
+        case PRNG_MARSAGLIA: marsaglia_fill_u64(state, out, count); break;
+        case PRNG_XORSHIFT:  xorshift_fill_u64(state, out, count);  break;
+        case PRNG_C99:       c99_fill_u64(state, out, count);       break;
+        case PRNG_PCG32:     pcg32_fill_u64(state, out, count);     break;
+        case PRNG_SPLITMIX:  splitmix_fill_u64(state, out, count);  break;
+        case PRNG_XOSHIRO128P_X4: chunked_fill_u64(state, lanes4_fill_u32, out, count); break;
+        case PRNG_XOSHIRO128P_X8: chunked_fill_u64(state, lanes8_fill_u32, out, count); break;
+        case PRNG_PHILOX4X32: chunked_fill_u64(state, philox_fill_u32, out, count); break;
+        case PRNG_XOSHIRO256SS: xoshiro256ss_fill_u64(state, out, count); break;
+        case PRNG_XOSHIRO256P: xoshiro256p_fill_u64(state, out, count); break;
+        case PRNG_WYRAND:    wyrand_fill_u64(state, out, count);    break;
+        case PRNG_SFC64:     sfc64_fill_u64(state, out, count);     break;
+        default:             memset(out, 0, count * sizeof(*out));  break;
+    }
+    return out;
+}
+
+double* prng_fill_double(prng_state_t* state, double* out, size_t count) {
+    assert(state != NULL);
+    assert(out != NULL || count == 0);
+
+    switch(state->engine) {
+        case PRNG_MARSAGLIA: marsaglia_fill_double(state, out, count); break;
+        case PRNG_XORSHIFT:  xorshift_fill_double(state, out, count);  break;
+        case PRNG_C99:       c99_fill_double(state, out, count);       break;
+        case PRNG_PCG32:     pcg32_fill_double(state, out, count);     break;
+        case PRNG_SPLITMIX:  splitmix_fill_double(state, out, count);  break;
+        case PRNG_XOSHIRO128P_X4: chunked_fill_double(state, lanes4_fill_u32, out, count); break;
+        case PRNG_XOSHIRO128P_X8: chunked_fill_double(state, lanes8_fill_u32, out, count); break;
+        case PRNG_PHILOX4X32: chunked_fill_double(state, philox_fill_u32, out, count); break;
+        case PRNG_XOSHIRO256SS: xoshiro256ss_fill_double(state, out, count); break;
+        case PRNG_XOSHIRO256P: xoshiro256p_fill_double(state, out, count); break;
+        case PRNG_WYRAND:    wyrand_fill_double(state, out, count);    break;
+        case PRNG_SFC64:     sfc64_fill_double(state, out, count);     break;
+        default:
+            for (size_t i = 0; i < count; i++) out[i] = 0.0;
+            break;
+    }
+    return out;
+}
+
 double prng_next_float(prng_state_t* state) {
     return prng_next_u32(state) * FLOAT_INV_2POW32; //   1.0 / FLOAT_2POW32
 }
 
-// Rejection sampling for strict uniformity
+uint64_t prng_next_u64(prng_state_t* state) {
+    assert(state != NULL);
+
+    switch(state->engine) {
+        case PRNG_MARSAGLIA: return marsaglia_next64(state);
+        case PRNG_XORSHIFT:  return xorshift_next64(state);
+        case PRNG_C99:       return c99_next64(state);
+        case PRNG_PCG32:     return pcg32_next64(state);
+        case PRNG_SPLITMIX:  return splitmix_next64(state);
+        case PRNG_XOSHIRO256SS: return xoshiro256ss_next64(state);
+        case PRNG_XOSHIRO256P: return xoshiro256p_next64(state);
+        case PRNG_WYRAND:    return wyrand_next64(state);
+        case PRNG_SFC64:     return sfc64_next64(state);
+        default: {
+            const uint64_t hi = prng_next_u32(state);
+            return (hi << 32) | prng_next_u32(state);
+        }
+    }
+}
+
+double prng_next_double53(prng_state_t* state) {
+    return (prng_next_u64(state) >> 11) * FLOAT_INV_2POW53;
+}
+
+double* prng_fill_double53(prng_state_t* state, double* out, size_t count) {
+    assert(state != NULL);
+    assert(out != NULL || count == 0);
+
+    uint64_t chunk[PRNG_FILL_CHUNK];
+    for (size_t done = 0; done < count; ) {
+        const size_t n = count - done < PRNG_FILL_CHUNK ? count - done : PRNG_FILL_CHUNK;
+        prng_fill_u64(state, chunk, n);
+        for (size_t i = 0; i < n; i++) {
+            out[done + i] = (chunk[i] >> 11) * FLOAT_INV_2POW53;
+        }
+        done += n;
+    }
+    return out;
+}
+
+// Lemire's multiply-shift: the high word of r * range is the result, the low
+// word decides rejection. The (2^32 - range) % range threshold is only needed
+// when the low word lands below range, i.e. with probability range / 2^32.
+static uint32_t range_reject(prng_state_t* state, uint64_t m, uint32_t range) {
+    const uint32_t threshold = -range % range;
+    while ((uint32_t)m < threshold) {
+        m = (uint64_t)prng_next_u32(state) * range;
+    }
+    return (uint32_t)(m >> 32);
+}
+
 uint32_t prng_range_exact(prng_state_t* state, uint32_t min, uint32_t max) {
     if (min == 0 && max == UINT32_MAX) { // Special case: no need for range reduction
         return prng_next_u32(state);
     }
     const uint32_t range = max - min + 1;
-    const uint32_t threshold = -range % range; // Equiv to (2^32 - range) % range
-    uint32_t r;
-    do {
-        r = prng_next_u32(state);
-    } while (r < threshold);
+    const uint64_t m = (uint64_t)prng_next_u32(state) * range;
+    if ((uint32_t)m < range) {
+        return min + range_reject(state, m, range);
+    }
+    return min + (uint32_t)(m >> 32);
+}
+
+uint32_t* prng_fill_range_u32(prng_state_t* state, uint32_t* out, size_t count, uint32_t min, uint32_t max) {
+    assert(state != NULL);
+    assert(out != NULL || count == 0);
+
+    prng_fill_u32(state, out, count);
+    if (min == 0 && max == UINT32_MAX) {
+        return out;
+    }
+    const uint32_t range = max - min + 1;
+    for (size_t i = 0; i < count; i++) {
+        const uint64_t m = (uint64_t)out[i] * range;
+        out[i] = min + ((uint32_t)m < range ? range_reject(state, m, range) : (uint32_t)(m >> 32));
+    }
+    return out;
+}
+
+// ========================
+// Jump-ahead
+// ========================
+
+// GF(2) polynomials of degree < 32*words (4 or 8 words), least significant
+// word first. Multiplication is modulo x^(32*words) + charpoly.
+#define F2_MAX_WORDS 8
 
-    return min + r % range;
+static void f2_mulmod(uint32_t* r, const uint32_t* a, const uint32_t* b, const uint32_t* charpoly, unsigned words) {
+    uint32_t acc[F2_MAX_WORDS] = {0};
+    uint32_t sh[F2_MAX_WORDS];
+    memcpy(sh, a, words * sizeof(uint32_t));
+    for (unsigned bit = 0; bit < 32 * words; bit++) {
+        if (b[bit / 32] >> (bit % 32) & 1U) {
+            for (unsigned w = 0; w < words; w++) acc[w] ^= sh[w];
+        }
+        const uint32_t carry = sh[words - 1] >> 31; // sh *= x
+        for (unsigned w = words - 1; w > 0; w--) {
+            sh[w] = (sh[w] << 1) | (sh[w - 1] >> 31);
+        }
+        sh[0] <<= 1;
+        if (carry) {
+            for (unsigned w = 0; w < words; w++) sh[w] ^= charpoly[w];
+        }
+    }
+    memcpy(r, acc, words * sizeof(uint32_t));
 }
 
-void prng_dump_compact(const prng_state_t* state, FILE* output) {
+// Jump polynomial x^(delta * 2^squarings) mod charpoly
+static void f2_jump_poly(uint32_t* poly, const uint32_t* charpoly, unsigned words, uint64_t delta, unsigned squarings) {
+    uint32_t base[F2_MAX_WORDS] = {2}; // x
+    uint32_t r[F2_MAX_WORDS] = {1};
+    while (delta) {
+        if (delta & 1) f2_mulmod(r, r, base, charpoly, words);
+        f2_mulmod(base, base, base, charpoly, words);
+        delta >>= 1;
+    }
+    while (squarings--) {
+        f2_mulmod(r, r, r, charpoly, words);
+    }
+    memcpy(poly, r, words * sizeof(uint32_t));
+}
+
+// state <- poly(T) state for an F2-linear step T on a state of the same size as
+// the polynomial (Horner over 32*words steps). XOR is bitwise, so the state
+// words may hold any packing of the engine's own state type.
+static void f2_apply(uint32_t* s, const uint32_t* poly, unsigned words, void (*step)(uint32_t* s)) {
+    uint32_t acc[F2_MAX_WORDS] = {0};
+    for (unsigned bit = 0; bit < 32 * words; bit++) {
+        if (poly[bit / 32] >> (bit % 32) & 1U) {
+            for (unsigned w = 0; w < words; w++) acc[w] ^= s[w];
+        }
+        step(s);
+    }
+    memcpy(s, acc, words * sizeof(uint32_t));
+}
+
+static void xorshift_step(uint32_t* x) {
+    prng_xorshift_t local;
+    memcpy(local.x, x, sizeof(local.x));
+    prng_xorshift_next_u32(&local);
+    memcpy(x, local.x, sizeof(local.x));
+}
+
+static void xoshiro128_step(uint32_t* s) {
+    uint32_t out;
+    uint32_t s0[1] = {s[0]}, s1[1] = {s[1]}, s2[1] = {s[2]}, s3[1] = {s[3]};
+    PRNG_LANES_STEP(1, s0, s1, s2, s3, &out)
+    s[0] = s0[0]; s[1] = s1[0]; s[2] = s2[0]; s[3] = s3[0];
+}
+
+static void xorshift_jump(prng_state_t* state, uint64_t delta, unsigned squarings) {
+    static const uint32_t charpoly[4] = XORSHIFT_CHARPOLY;
+    uint32_t poly[4];
+    f2_jump_poly(poly, charpoly, 4, delta, squarings);
+    f2_apply(state->state.xorshift.x, poly, 4, xorshift_step);
+}
+
+static void xoshiro256_step(uint32_t* s) {
+    prng_xoshiro256_t local;
+    memcpy(&local, s, sizeof(local));
+    prng_xoshiro256_step(&local);
+    memcpy(s, &local, sizeof(local));
+}
+
+static void xoshiro256_jump(prng_state_t* state, uint64_t delta, unsigned squarings) {
+    static const uint32_t charpoly[8] = XOSHIRO256_CHARPOLY;
+    uint32_t poly[8], words[8];
+    f2_jump_poly(poly, charpoly, 8, delta, squarings);
+    memcpy(words, &state->state.xoshiro256, sizeof(words));
+    f2_apply(words, poly, 8, xoshiro256_step);
+    memcpy(&state->state.xoshiro256, words, sizeof(words));
+}
+
+// Advances every lane by the same number of steps (one polynomial for all)
+static void lanes_jump(prng_state_t* state, uint64_t delta, unsigned squarings) {
+    static const uint32_t charpoly[4] = XOSHIRO_CHARPOLY;
+    uint32_t poly[4];
+    f2_jump_poly(poly, charpoly, 4, delta, squarings);
+    for (unsigned l = 0; l < lanes_count(state); l++) {
+        uint32_t lane[4];
+        for (unsigned w = 0; w < 4; w++) lane[w] = state->state.lanes.s[w][l];
+        f2_apply(lane, poly, 4, xoshiro128_step);
+        for (unsigned w = 0; w < 4; w++) state->state.lanes.s[w][l] = lane[w];
+    }
+}
+
+// Exact output count: finish the buffered block, jump whole blocks, refill for the rest
+static void lanes_advance(prng_state_t* state, uint64_t delta) {
+    const unsigned lanes = lanes_count(state);
+    while (delta && state->state.lanes.pos < lanes) {
+        state->state.lanes.pos++;
+        delta--;
+    }
+    if (!delta) return;
+
+    if (delta / lanes) {
+        lanes_jump(state, delta / lanes, 0);
+    }
+    if (delta % lanes) {
+        state->state.lanes.pos = lanes;
+        prng_next_u32(state); // computes the next block
+        state->state.lanes.pos = (uint32_t)(delta % lanes);
+    }
+}
+
+// O(1): finish the buffered block, move the counter, refill for the rest
+static void philox_advance(prng_state_t* state, uint64_t delta) {
+    while (delta && state->state.philox.pos < PHILOX_BLOCK) {
+        state->state.philox.pos++;
+        delta--;
+    }
+    philox_add(state->state.philox.ctr, 0, delta / PHILOX_BLOCK);
+    if (delta % PHILOX_BLOCK) {
+        philox_next(state);
+        state->state.philox.pos = (uint32_t)(delta % PHILOX_BLOCK);
+    }
+}
+
+// Brown's O(log n) affine power: state <- MULT^delta * state + INC * (MULT^delta - 1) / (MULT - 1)
+static void pcg32_advance(prng_state_t* state, uint64_t delta) {
+    uint64_t cur_mult = PCG_MULTIPLIER, cur_plus = PCG_INCREMENT;
+    uint64_t acc_mult = 1, acc_plus = 0;
+    while (delta) {
+        if (delta & 1) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+        delta >>= 1;
+    }
+    state->state.pcg.state = acc_mult * state->state.pcg.state + acc_plus;
+}
+
+// Same affine power on the 32-bit C99 LCG
+static void c99_advance(prng_state_t* state, uint64_t delta) {
+    uint32_t cur_mult = C99_LCG_MULTIPLIER, cur_plus = C99_LCG_INCREMENT;
+    uint32_t acc_mult = 1, acc_plus = 0;
+    while (delta) {
+        if (delta & 1) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+        delta >>= 1;
+    }
+    state->state.c99_seed = acc_mult * state->state.c99_seed + acc_plus;
+}
+
+prng_state_t* prng_advance(prng_state_t* state, uint64_t delta) {
+    assert(state != NULL);
+
+    switch (state->engine) {
+        case PRNG_XORSHIFT:       xorshift_jump(state, delta, 0);    break;
+        case PRNG_PCG32:          pcg32_advance(state, delta);       break;
+        case PRNG_C99:            c99_advance(state, delta);         break;
+        case PRNG_SPLITMIX:       state->state.splitmix.x += delta * SPLITMIX_INCREMENT; break;
+        case PRNG_XOSHIRO128P_X4:
+        case PRNG_XOSHIRO128P_X8: lanes_advance(state, delta);       break;
+        case PRNG_PHILOX4X32:     philox_advance(state, delta);      break;
+        case PRNG_XOSHIRO256SS:
+        case PRNG_XOSHIRO256P:    xoshiro256_jump(state, delta, 0);  break;
+        case PRNG_WYRAND:         state->state.wyrand.x += delta * WYRAND_INCREMENT; break;
+        default:
+            for (uint64_t i = 0; i < delta; i++) prng_next_u32(state);
+            break;
+    }
+    return state;
+}
+
+prng_state_t* prng_jump(prng_state_t* state) {
+    assert(state != NULL);
+
+    switch (state->engine) {
+        case PRNG_XORSHIFT:
+            xorshift_jump(state, 1, PRNG_JUMP_LOG2_128);
+            break;
+        case PRNG_XOSHIRO256SS:
+        case PRNG_XOSHIRO256P:
+            xoshiro256_jump(state, 1, PRNG_JUMP_LOG2_256);
+            break;
+        case PRNG_PCG32:
+        case PRNG_SPLITMIX:
+        case PRNG_WYRAND:
+            prng_advance(state, (uint64_t)1 << PRNG_JUMP_LOG2_64);
+            break;
+        case PRNG_XOSHIRO128P_X4:
+        case PRNG_XOSHIRO128P_X8:
+            state->state.lanes.pos = lanes_count(state);
+            lanes_jump(state, 1, PRNG_JUMP_LOG2_128);
+            break;
+        case PRNG_PHILOX4X32:
+            state->state.philox.pos = PHILOX_BLOCK;
+            philox_add(state->state.philox.ctr, 2, 1); // next 2^64-block window
+            break;
+        default:
+            errno = EINVAL;
+            return NULL;
+    }
+    return state;
+}
+
+prng_state_t* prng_philox_seek(prng_state_t* state, uint64_t block_hi, uint64_t block_lo) {
+    assert(state != NULL);
+
+    if (state->engine != PRNG_PHILOX4X32) {
+        errno = EINVAL;
+        return NULL;
+    }
+    state->state.philox.ctr[0] = (uint32_t)block_lo;
+    state->state.philox.ctr[1] = (uint32_t)(block_lo >> 32);
+    state->state.philox.ctr[2] = (uint32_t)block_hi;
+    state->state.philox.ctr[3] = (uint32_t)(block_hi >> 32);
+    state->state.philox.pos = PHILOX_BLOCK;
+    return state;
+}
+
+prng_state_t* prng_split(prng_state_t* parent, prng_state_t* child) {
+    assert(parent != NULL && child != NULL && parent != child);
+
+    const prng_state_t position = *parent;
+    if (!prng_jump(parent)) {
+        return NULL;
+    }
+    *child = position;
+    return child;
+}
+
+// ========================
+// Checkpoints
+// ========================
+
+// One field walk serves save, load and size: out writes, in reads, neither just counts
+typedef struct {
+    uint8_t* out;
+    const uint8_t* in;
+    size_t len;
+} prng_codec_t;
+
+// Words are stored little-endian whatever the host order
+static void codec_u32(prng_codec_t* io, uint32_t* word) {
+    if (io->out) {
+        for (unsigned i = 0; i < 4; i++) {
+            io->out[io->len + i] = (uint8_t)(*word >> (8 * i));
+        }
+    } else if (io->in) {
+        uint32_t v = 0;
+        for (unsigned i = 0; i < 4; i++) {
+            v |= (uint32_t)io->in[io->len + i] << (8 * i);
+        }
+        *word = v;
+    }
+    io->len += 4;
+}
+
+static void codec_u64(prng_codec_t* io, uint64_t* word) {
+    uint32_t lo = (uint32_t)*word, hi = (uint32_t)(*word >> 32);
+    codec_u32(io, &lo);
+    codec_u32(io, &hi);
+    *word = ((uint64_t)hi << 32) | lo;
+}
+
+// Version byte, engine tag, then the engine's words; the lane engines store only their own lanes
+static void codec_state(prng_codec_t* io, prng_state_t* state) {
+    uint8_t header[PRNG_SAVE_HEADER] = {PRNG_SAVE_VERSION, (uint8_t)state->engine};
+    if (io->out) {
+        memcpy(io->out + io->len, header, sizeof(header));
+    }
+    io->len += sizeof(header);
+
+    switch (state->engine) {
+        case PRNG_MARSAGLIA:
+            codec_u32(io, &state->state.mwc.a);
+            codec_u32(io, &state->state.mwc.b);
+            codec_u32(io, &state->state.mwc.c);
+            codec_u32(io, &state->state.mwc.d);
+            break;
+
+        case PRNG_XORSHIFT:
+            for (unsigned i = 0; i < 4; i++) codec_u32(io, &state->state.xorshift.x[i]);
+            break;
+
+        case PRNG_C99:
+            codec_u32(io, &state->state.c99_seed);
+            break;
+
+        case PRNG_PCG32:
+            codec_u64(io, &state->state.pcg.state);
+            codec_u64(io, &state->state.pcg.inc);
+            break;
+
+        case PRNG_SPLITMIX:
+            codec_u64(io, &state->state.splitmix.x);
+            break;
+
+        case PRNG_XOSHIRO128P_X4:
+        case PRNG_XOSHIRO128P_X8: {
+            const unsigned lanes = lanes_count(state);
+            for (unsigned w = 0; w < 4; w++) {
+                for (unsigned l = 0; l < lanes; l++) codec_u32(io, &state->state.lanes.s[w][l]);
+            }
+            for (unsigned l = 0; l < lanes; l++) codec_u32(io, &state->state.lanes.out[l]);
+            codec_u32(io, &state->state.lanes.pos);
+            break;
+        }
+
+        case PRNG_PHILOX4X32:
+            for (unsigned i = 0; i < 2; i++) codec_u32(io, &state->state.philox.key[i]);
+            for (unsigned i = 0; i < 4; i++) codec_u32(io, &state->state.philox.ctr[i]);
+            for (unsigned i = 0; i < PHILOX_BLOCK; i++) codec_u32(io, &state->state.philox.out[i]);
+            codec_u32(io, &state->state.philox.pos);
+            break;
+
+        case PRNG_XOSHIRO256SS:
+        case PRNG_XOSHIRO256P:
+            for (unsigned i = 0; i < 4; i++) codec_u64(io, &state->state.xoshiro256.s[i]);
+            break;
+
+        case PRNG_WYRAND:
+            codec_u64(io, &state->state.wyrand.x);
+            break;
+
+        case PRNG_SFC64:
+            codec_u64(io, &state->state.sfc64.a);
+            codec_u64(io, &state->state.sfc64.b);
+            codec_u64(io, &state->state.sfc64.c);
+            codec_u64(io, &state->state.sfc64.counter);
+            break;
+    }
+}
+
+// Size of the record starting at buf, 0 if the header is unusable (errno set)
+static size_t load_record_size(const uint8_t* buf, size_t size) {
+    if (size < PRNG_SAVE_HEADER) {
+        errno = ERANGE;
+        return 0;
+    }
+    if (buf[0] != PRNG_SAVE_VERSION || buf[1] >= PRNG_ENGINE_COUNT) {
+        errno = EINVAL;
+        return 0;
+    }
+
+    prng_state_t probe;
+    probe.engine = (prng_engine_t)buf[1];
+    prng_codec_t io = {NULL, NULL, 0};
+    codec_state(&io, &probe);
+    if (size < io.len) {
+        errno = ERANGE;
+        return 0;
+    }
+    return io.len;
+}
+
+// Decodes one record into state, which is only written if the record is valid
+static size_t load_record(prng_state_t* state, const uint8_t* buf, size_t size) {
+    const size_t len = load_record_size(buf, size);
+    if (!len) {
+        return 0;
+    }
+
+    prng_state_t loaded;
+    memset(&loaded, 0, sizeof(loaded));
+    loaded.engine = (prng_engine_t)buf[1];
+    prng_codec_t io = {NULL, buf, 0};
+    codec_state(&io, &loaded);
+
+    // A corrupt buffer position would index past the output block
+    if (((loaded.engine == PRNG_XOSHIRO128P_X4 || loaded.engine == PRNG_XOSHIRO128P_X8) &&
+         loaded.state.lanes.pos > lanes_count(&loaded)) ||
+        (loaded.engine == PRNG_PHILOX4X32 && loaded.state.philox.pos > PHILOX_BLOCK)) {
+        errno = EINVAL;
+        return 0;
+    }
+
+    *state = loaded;
+    return len;
+}
+
+size_t prng_save_size(const prng_state_t* state) {
+    assert(state != NULL && "State cannot be NULL");
+
+    prng_state_t copy = *state;
+    prng_codec_t io = {NULL, NULL, 0};
+    codec_state(&io, &copy);
+    return io.len;
+}
+
+uint8_t* prng_save(const prng_state_t* state, uint8_t* buf, size_t size) {
+    assert(state != NULL && buf != NULL);
+
+    if (size < prng_save_size(state)) {
+        errno = ERANGE;
+        return NULL;
+    }
+    prng_state_t copy = *state;
+    prng_codec_t io = {buf, NULL, 0};
+    codec_state(&io, &copy);
+    return buf;
+}
+
+prng_state_t* prng_load(prng_state_t* state, const uint8_t* buf, size_t size) {
+    assert(state != NULL && buf != NULL);
+
+    return load_record(state, buf, size) ? state : NULL;
+}
+
+size_t prng_save_array_size(const prng_state_t* states, size_t count) {
+    assert(states != NULL || count == 0);
+
+    size_t total = PRNG_SAVE_ARRAY_HEADER;
+    for (size_t i = 0; i < count; i++) {
+        const size_t record = prng_save_size(&states[i]);
+        if (total > SIZE_MAX - record) {
+            return 0; // does not fit a size_t (64KB on 16-bit targets)
+        }
+        total += record;
+    }
+    return total;
+}
+
+uint8_t* prng_save_array(const prng_state_t* states, size_t count, uint8_t* buf, size_t size) {
+    assert((states != NULL || count == 0) && buf != NULL);
+
+    const size_t needed = prng_save_array_size(states, count);
+    if (count > UINT32_MAX || needed == 0 || size < needed) {
+        errno = ERANGE;
+        return NULL;
+    }
+
+    prng_codec_t io = {buf, NULL, 0};
+    buf[0] = PRNG_SAVE_VERSION;
+    buf[1] = PRNG_SAVE_ARRAY_TAG;
+    io.len = 2;
+    uint32_t n = (uint32_t)count;
+    codec_u32(&io, &n);
+
+    for (size_t i = 0; i < count; i++) {
+        prng_state_t copy = states[i];
+        codec_state(&io, &copy);
+    }
+    return buf;
+}
+
+prng_state_t* prng_load_array(prng_state_t* states, size_t count, const uint8_t* buf, size_t size) {
+    assert((states != NULL || count == 0) && buf != NULL);
+
+    if (size < PRNG_SAVE_ARRAY_HEADER) {
+        errno = ERANGE;
+        return NULL;
+    }
+    prng_codec_t io = {NULL, buf, 2};
+    uint32_t n = 0;
+    codec_u32(&io, &n);
+    if (buf[0] != PRNG_SAVE_VERSION || buf[1] != PRNG_SAVE_ARRAY_TAG || n != count) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    // Decode every record once into scratch so a bad one leaves states untouched
+    size_t pos = io.len;
+    for (size_t i = 0; i < count; i++) {
+        prng_state_t scratch;
+        const size_t len = load_record(&scratch, buf + pos, size - pos);
+        if (!len) {
+            return NULL;
+        }
+        pos += len;
+    }
+
+    pos = io.len;
+    for (size_t i = 0; i < count; i++) {
+        pos += load_record(&states[i], buf + pos, size - pos);
+    }
+    return states;
+}
+
+void prng_dump(const prng_state_t* state, FILE* output) {
     if (!state) return;
     FILE *out = output ? output : stdout;
 
@@ -198,7 +1113,47 @@ void prng_dump_compact(const prng_state_t* state, FILE* output) {
         case PRNG_SPLITMIX:
             fprintf(out, "[PRNG] %s State:0x%016llX",
                    prng_to_string[state->engine],
-                   (unsigned long long)state->state.splitmix);
+                   (unsigned long long)state->state.splitmix.x);
+            break;
+
+        case PRNG_XOSHIRO128P_X4:
+        case PRNG_XOSHIRO128P_X8:
+            fprintf(out, "[PRNG] %s Lane0:0x%08X..0x%08X Buffered:%u",
+                   prng_to_string[state->engine],
+                   state->state.lanes.s[0][0],
+                   state->state.lanes.s[3][0],
+                   lanes_count(state) - state->state.lanes.pos);
+            break;
+
+        case PRNG_PHILOX4X32:
+            fprintf(out, "[PRNG] %s Key:0x%08X%08X Ctr:0x%08X%08X%08X%08X",
+                   prng_to_string[state->engine],
+                   state->state.philox.key[1], state->state.philox.key[0],
+                   state->state.philox.ctr[3], state->state.philox.ctr[2],
+                   state->state.philox.ctr[1], state->state.philox.ctr[0]);
+            break;
+
+        case PRNG_XOSHIRO256SS:
+        case PRNG_XOSHIRO256P:
+            fprintf(out, "[PRNG] %s State:0x%016llX..0x%016llX",
+                   prng_to_string[state->engine],
+                   (unsigned long long)state->state.xoshiro256.s[0],
+                   (unsigned long long)state->state.xoshiro256.s[3]);
+            break;
+
+        case PRNG_WYRAND:
+            fprintf(out, "[PRNG] %s State:0x%016llX",
+                   prng_to_string[state->engine],
+                   (unsigned long long)state->state.wyrand.x);
+            break;
+
+        case PRNG_SFC64:
+            fprintf(out, "[PRNG] %s State:a=0x%016llX b=0x%016llX c=0x%016llX Ctr:%llu",
+                   prng_to_string[state->engine],
+                   (unsigned long long)state->state.sfc64.a,
+                   (unsigned long long)state->state.sfc64.b,
+                   (unsigned long long)state->state.sfc64.c,
+                   (unsigned long long)state->state.sfc64.counter);
             break;
     }
 
@@ -2,10 +2,12 @@
 #define PRNG_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdbool.h>
 
 #include "prng_constants.h"
+#include "prng_inline.h"
 
 typedef enum {
     /**
@@ -41,17 +43,20 @@ typedef enum {
     PRNG_XORSHIFT,
 
     /**
-     * @brief Standard C99 rand() (LCG implementation)
-     * @period Typically 2^31-1
+     * @brief Standard C99 rand() (the ISO C reference LCG, kept in the state)
+     * @period 2^32
      * @speed 0.8x
-     * @quality Poor, for compatibility only
+     * @quality Poor, for compatibility only: 15-bit outputs in [0, 32767]
      * @recommended_for Comparison/testing only
+     * @note Reentrant: each prng_state_t has its own LCG, so threads never
+     *       share state the way srand()/rand() do
      * @code{.c}
      * // Example: Compatibility mode
      * prng_state_t rng;
      * prng_init(&rng, PRNG_C99, 12345, 0, NULL); // no warmup, no seed logging
-     * // Matches standard rand() output:
-     * printf("%d\n", (int)(prng_next_float(&rng) * RAND_MAX));
+     * // Same values as rand() after srand(12345) on a C library using the
+     * // ISO reference implementation (e.g. Open Watcom):
+     * printf("%u\n", prng_next_u32(&rng));
      * @endcode
      */
     PRNG_C99,
@@ -79,14 +84,125 @@ typedef enum {
      * @recommended_for Parallel streams
      * @code{.c}
      * // Example: Parallel stream initialization
+     * // (seeds base_seed and base_seed + 1 sit on the same 2^64 cycle at an
+     * //  uncontrolled offset, so their streams can overlap)
      * prng_state_t rng1, rng2;
-     * uint64_t base_seed = prng_default_seed();
-     * prng_init(&rng1, PRNG_SPLITMIX, base_seed, 16, NULL);
-     * prng_init(&rng2, PRNG_SPLITMIX, base_seed + 1, 16, NULL);
-     * // Now rng1 and rng2 produce independent streams
+     * prng_init(&rng1, PRNG_SPLITMIX, prng_default_seed(), 16, NULL);
+     * prng_split(&rng1, &rng2);
+     * // rng2 owns the next 2^48 values, rng1 continues after them
      * @endcode
      */
-    PRNG_SPLITMIX
+    PRNG_SPLITMIX,
+
+    /**
+     * @brief Xoshiro128+ in 4 independent lanes (structure-of-arrays)
+     * @period 2^128-1 per lane
+     * @speed Bulk fills: one fixed-width lane loop per 4 outputs, which
+     *        compilers turn into 128-bit vector code
+     * @quality Good; the lowest bits are weaker (as in all xoshiro "+")
+     * @recommended_for prng_fill_u32()/prng_fill_double() over large buffers
+     * @code{.c}
+     * // Example: Lanes are seeded from one seed with SplitMix64
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_XOSHIRO128P_X4, 0xC0FFEE, 0, NULL);
+     * static uint32_t buffer[1 << 16];
+     * prng_fill_u32(&rng, buffer, 1 << 16);
+     * @endcode
+     */
+    PRNG_XOSHIRO128P_X4,
+
+    /**
+     * @brief Xoshiro128+ in 8 independent lanes (structure-of-arrays)
+     * @period 2^128-1 per lane
+     * @speed As PRNG_XOSHIRO128P_X4, sized for 256-bit vector units
+     * @quality Good; the lowest bits are weaker (as in all xoshiro "+")
+     * @recommended_for Bulk fills on wide-vector hardware
+     * @code{.c}
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_XOSHIRO128P_X8, 0xC0FFEE, 0, NULL);
+     * double u[4096];
+     * prng_fill_double(&rng, u, 4096);
+     * @endcode
+     */
+    PRNG_XOSHIRO128P_X8,
+
+    /**
+     * @brief Philox4x32-10 (counter-based, Random123)
+     * @period 2^130 outputs per key (128-bit counter, 4 outputs per block)
+     * @speed Bulk fills write whole blocks; ten multiply rounds per 4 outputs
+     * @quality Excellent, passes BigCrush
+     * @recommended_for Reproducible parallel simulations: every output is a
+     *                  pure function of (seed, position), independent of
+     *                  which thread draws it or when
+     * @code{.c}
+     * // Example: Particle p at time step t always sees the same numbers
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_PHILOX4X32, run_seed, 0, NULL);
+     * prng_philox_seek(&rng, particle_id, time_step);
+     * double kick = prng_next_float(&rng);
+     * @endcode
+     */
+    PRNG_PHILOX4X32,
+
+    /**
+     * @brief Xoshiro256** (Blackman & Vigna)
+     * @period 2^256-1
+     * @speed Native 64-bit output; fastest engine for prng_next_u64()
+     * @quality Excellent, passes BigCrush and PractRand
+     * @recommended_for General purpose 64-bit generation, huge parallel runs
+     *                  (prng_jump() skips 2^128)
+     * @code{.c}
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_XOSHIRO256SS, 0xC0FFEE, 0, NULL);
+     * double p = prng_next_double53(&rng);
+     * @endcode
+     */
+    PRNG_XOSHIRO256SS,
+
+    /**
+     * @brief Xoshiro256+ (Blackman & Vigna)
+     * @period 2^256-1
+     * @speed Slightly faster than Xoshiro256** (one add instead of two multiplies)
+     * @quality Excellent in the high bits; the lowest bits are weak, which
+     *          the 32-bit and 53-bit outputs never use
+     * @recommended_for Floating-point generation
+     * @code{.c}
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_XOSHIRO256P, 0xC0FFEE, 0, NULL);
+     * double u[1024];
+     * prng_fill_double53(&rng, u, 1024);
+     * @endcode
+     */
+    PRNG_XOSHIRO256P,
+
+    /**
+     * @brief Wyrand (Wang Yi)
+     * @period 2^64
+     * @speed Native 64-bit output, one 64x64->128 multiply per value
+     * @quality Good, passes BigCrush and PractRand
+     * @recommended_for Fast 64-bit values on hardware with a wide multiplier
+     * @code{.c}
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_WYRAND, 0xC0FFEE, 0, NULL);
+     * uint64_t key = prng_next_u64(&rng);
+     * @endcode
+     */
+    PRNG_WYRAND,
+
+    /**
+     * @brief SFC64 (Small Fast Chaotic, Doty-Humphrey)
+     * @period At least 2^64 (counter), about 2^255 on average
+     * @speed Native 64-bit output, adds/shifts/rotates only (no multiply)
+     * @quality Excellent, passes BigCrush and PractRand
+     * @recommended_for CPUs with slow multipliers; no jump-ahead (prng_jump()
+     *                  reports EINVAL)
+     * @code{.c}
+     * prng_state_t rng;
+     * prng_init(&rng, PRNG_SFC64, 0xC0FFEE, 0, NULL);
+     * uint32_t r = prng_next_u32(&rng);
+     * @endcode
+     */
+    PRNG_SFC64
 
 } prng_engine_t;
 
@@ -107,20 +223,46 @@ const prng_engine_t prng_engine_list[PRNG_ENGINE_COUNT] = {
     PRNG_C99,
     PRNG_PCG32,
     PRNG_SPLITMIX,
+    PRNG_XOSHIRO128P_X4,
+    PRNG_XOSHIRO128P_X8,
+    PRNG_PHILOX4X32,
+    PRNG_XOSHIRO256SS,
+    PRNG_XOSHIRO256P,
+    PRNG_WYRAND,
+    PRNG_SFC64,
 };
 
 typedef struct {
     union {
         // Marsaglia MWC
-        struct { uint32_t a, b, c, d; } mwc;
+        prng_mwc_t mwc;
         // XORShift128
-        struct { uint32_t x[4]; } xorshift;
-        // C99 (uses global state)
+        prng_xorshift_t xorshift;
+        // C99 rand() LCG
         uint32_t c99_seed;
         // PCG32
-        struct { uint64_t state; uint64_t inc; } pcg;
+        prng_pcg32_t pcg;
         // SplitMix
-        uint64_t splitmix;
+        prng_splitmix_t splitmix;
+        // Multi-lane Xoshiro128+: s[word][lane], plus one block of buffered outputs
+        struct {
+            uint32_t s[4][PRNG_LANES_MAX];
+            uint32_t out[PRNG_LANES_MAX];
+            uint32_t pos;
+        } lanes;
+        // Philox4x32-10: key, next counter value, and the current block's outputs
+        struct {
+            uint32_t key[2];
+            uint32_t ctr[4];
+            uint32_t out[PHILOX_BLOCK];
+            uint32_t pos;
+        } philox;
+        // Xoshiro256** and Xoshiro256+
+        prng_xoshiro256_t xoshiro256;
+        // Wyrand
+        prng_wyrand_t wyrand;
+        // SFC64
+        prng_sfc64_t sfc64;
     } state;
     prng_engine_t engine;
 } prng_state_t;
@@ -248,7 +390,9 @@ static inline uint32_t prng_range_u32(uint32_t r, uint32_t min, uint32_t max) {
  * @param min Lower bound (inclusive)
  * @param max Upper bound (inclusive)
  * @return uint32_t Random value in range
- * @note Uses rejection sampling for perfect uniformity
+ * @note Lemire's multiply-shift rejection: one 32x32->64 multiply per draw,
+ *       and a division only in the rare case (probability range/2^32) where
+ *       the draw may have to be rejected
  * @code{.c}
  * // Example: Shuffling a deck of cards
  * prng_state_t rng;
@@ -268,6 +412,272 @@ static inline uint32_t prng_range_u32(uint32_t r, uint32_t min, uint32_t max) {
  */
 uint32_t prng_range_exact(prng_state_t* state, uint32_t min, uint32_t max);
 
+/**
+ * @brief Fills a buffer with perfectly uniform values in [min, max]
+ * @param state Initialized PRNG state
+ * @param out Destination buffer
+ * @param count Number of values
+ * @param min Lower bound (inclusive)
+ * @param max Upper bound (inclusive)
+ * @return out pointer for chaining
+ * @note Draws count raw words with prng_fill_u32() and maps them in place, so
+ *       the values equal repeated prng_range_exact() calls except after a
+ *       rejection, whose replacement draw comes after the whole batch.
+ * @code{.c}
+ * // Example: 1000 sample indices into a 250-element population
+ * uint32_t idx[1000];
+ * prng_fill_range_u32(&rng, idx, 1000, 0, 249);
+ * @endcode
+ */
+uint32_t* prng_fill_range_u32(prng_state_t* state, uint32_t* out, size_t count, uint32_t min, uint32_t max);
+
+/**
+ * @brief Fills a buffer with 32-bit values
+ * @param state Initialized PRNG state
+ * @param out Destination buffer
+ * @param count Number of values
+ * @return out pointer for chaining
+ * @note Dispatches on the engine once, then runs a loop with the state held in
+ *       locals. The output equals count calls to prng_next_u32().
+ * @code{.c}
+ * // Example: Refill a noise buffer once per frame
+ * prng_state_t rng;
+ * prng_init(&rng, PRNG_XORSHIFT, prng_default_seed(), 16, NULL);
+ * uint32_t noise[256];
+ * prng_fill_u32(&rng, noise, 256);
+ * @endcode
+ */
+uint32_t* prng_fill_u32(prng_state_t* state, uint32_t* out, size_t count);
+
+/**
+ * @brief Fills a buffer with 64-bit values
+ * @param state Initialized PRNG state
+ * @param out Destination buffer
+ * @param count Number of values
+ * @return out pointer for chaining
+ * @note SplitMix64, Xoshiro256, Wyrand and SFC64 emit their native 64-bit
+ *       output. The 32-bit engines join two consecutive prng_next_u32()
+ *       values, the first one in the high half. C99 shifts in five 15-bit
+ *       rand() values, oldest first, so every bit is random.
+ * @code{.c}
+ * // Example: 64-bit hash keys
+ * uint64_t keys[64];
+ * prng_fill_u64(&rng, keys, 64);
+ * @endcode
+ */
+uint64_t* prng_fill_u64(prng_state_t* state, uint64_t* out, size_t count);
+
+/**
+ * @brief Fills a buffer with uniform doubles in [0,1)
+ * @param state Initialized PRNG state
+ * @param out Destination buffer
+ * @param count Number of values
+ * @return out pointer for chaining
+ * @note Same values as count calls to prng_next_float()
+ * @code{.c}
+ * // Example: Batch of probabilities for a Monte Carlo step
+ * double u[1024];
+ * prng_fill_double(&rng, u, 1024);
+ * @endcode
+ */
+double* prng_fill_double(prng_state_t* state, double* out, size_t count);
+
+/**
+ * @brief Generates a full-range 64-bit value
+ * @param state Initialized PRNG state
+ * @return uint64_t Random 64-bit value
+ * @note SplitMix64, Xoshiro256, Wyrand and SFC64 return one native 64-bit
+ *       step. The other engines have 32-bit outputs and join two
+ *       prng_next_u32() values, the first one in the high half; C99 (15-bit
+ *       outputs) joins five. Always the same values as prng_fill_u64().
+ * @code{.c}
+ * // Example: 64-bit object id
+ * uint64_t id = prng_next_u64(&rng);
+ * @endcode
+ */
+uint64_t prng_next_u64(prng_state_t* state);
+
+/**
+ * @brief Generates a uniform double in [0,1) with all 53 mantissa bits random
+ * @param state Initialized PRNG state
+ * @return double (prng_next_u64() >> 11) * 2^-53
+ * @note prng_next_float() only carries 32 random bits (steps of 2^-32). Use
+ *       this one for probability thresholds finer than that.
+ * @code{.c}
+ * // Example: A one-in-ten-billion event
+ * if (prng_next_double53(&rng) < 1e-10) {
+ *     rare_event();
+ * }
+ * @endcode
+ */
+double prng_next_double53(prng_state_t* state);
+
+/**
+ * @brief Fills a buffer with 53-bit uniform doubles in [0,1)
+ * @param state Initialized PRNG state
+ * @param out Destination buffer
+ * @param count Number of values
+ * @return out pointer for chaining
+ * @note Same values as count calls to prng_next_double53()
+ */
+double* prng_fill_double53(prng_state_t* state, double* out, size_t count);
+
+/**
+ * @brief Advances the generator as if prng_next_u32() had been called delta times
+ * @param state Initialized PRNG state
+ * @param delta Number of 32-bit outputs to skip
+ * @return state pointer for chaining
+ * @note O(log delta) for PCG32 and C99 (LCG affine power), XORShift128**, the
+ *       xoshiro lanes and Xoshiro256 (x^delta mod the characteristic
+ *       polynomial, applied in 128 or 256 steps). O(1) for SplitMix64, Wyrand
+ *       and Philox (counter add). Marsaglia's MWC and SFC64 have no closed
+ *       form and are stepped delta times.
+ * @code{.c}
+ * // Example: Worker k of n reads its own slice of one sequence
+ * prng_init(&rng, PRNG_PCG32, 42, 0, NULL);
+ * prng_advance(&rng, (uint64_t)k * per_worker);
+ * @endcode
+ */
+prng_state_t* prng_advance(prng_state_t* state, uint64_t delta);
+
+/**
+ * @brief Jumps ahead by the engine's jump distance
+ * @param state Initialized PRNG state
+ * @return state pointer for chaining, NULL if the engine cannot jump
+ * @throws EINVAL for PRNG_MARSAGLIA, PRNG_SFC64 and PRNG_C99 (state unchanged)
+ * @note Distances: 2^128 outputs for Xoshiro256 (PRNG_JUMP_LOG2_256), 2^64
+ *       for XORShift128** (PRNG_JUMP_LOG2_128), 2^48 for PCG32, SplitMix64 and
+ *       Wyrand (PRNG_JUMP_LOG2_64). The lane
+ *       engines drop any buffered outputs of the current block and advance
+ *       every lane by 2^64 steps. Philox drops its buffered block and adds 1
+ *       to the high 64 bits of the counter (2^64 blocks).
+ */
+prng_state_t* prng_jump(prng_state_t* state);
+
+/**
+ * @brief One Philox4x32-10 block: a pure function of key and counter
+ * @param key 64-bit key as two words, low word first
+ * @param counter 128-bit counter as four words, least significant first
+ * @param out Receives the four output words
+ * @return out pointer for chaining
+ * @note prng_init(PRNG_PHILOX4X32, seed) uses key {seed, seed >> 32} and
+ *       emits the blocks for counters 0, 1, 2, ...
+ */
+uint32_t* prng_philox_block(const uint32_t key[2], const uint32_t counter[4], uint32_t out[4]);
+
+/**
+ * @brief Moves a Philox state to an absolute block position
+ * @param state State initialized with PRNG_PHILOX4X32
+ * @param block_hi High 64 bits of the counter (e.g. a stream or particle id)
+ * @param block_lo Low 64 bits of the counter (e.g. a step within the stream)
+ * @return state pointer for chaining, NULL for other engines
+ * @throws EINVAL if state is not a Philox state (state unchanged)
+ * @note The next prng_next_u32() returns word 0 of that block.
+ */
+prng_state_t* prng_philox_seek(prng_state_t* state, uint64_t block_hi, uint64_t block_lo);
+
+/**
+ * @brief Splits off a non-overlapping substream for a parallel worker
+ * @param parent Initialized PRNG state, jumped past the child's substream
+ * @param child Receives the parent's current position
+ * @return child pointer for chaining, NULL if the engine cannot jump
+ * @throws EINVAL for PRNG_MARSAGLIA, PRNG_SFC64 and PRNG_C99 (neither state is touched)
+ * @note The streams are disjoint as long as each child draws fewer values than
+ *       the jump distance of prng_jump().
+ * @code{.c}
+ * // Example: One stream per Monte Carlo worker, all from one seed
+ * prng_state_t master, workers[8];
+ * prng_init(&master, PRNG_XORSHIFT, 0xC0FFEE, 0, NULL);
+ * for (int w = 0; w < 8; w++) {
+ *     prng_split(&master, &workers[w]);
+ * }
+ * @endcode
+ */
+prng_state_t* prng_split(prng_state_t* parent, prng_state_t* child);
+
+/**
+ * @brief Bytes prng_save() writes for this state
+ * @param state Initialized PRNG state
+ * @return Record size, at most PRNG_SAVE_MAX
+ */
+size_t prng_save_size(const prng_state_t* state);
+
+/**
+ * @brief Writes an exact binary checkpoint of a PRNG state
+ * @param state Initialized PRNG state
+ * @param buf Destination buffer
+ * @param size Capacity of buf in bytes
+ * @return buf pointer for chaining, NULL if buf is too small
+ * @throws ERANGE if size < prng_save_size(state) (buf unchanged)
+ * @note Layout: PRNG_SAVE_VERSION byte, engine tag byte, then the engine's
+ *       state words in little-endian order, so checkpoints move between hosts.
+ *       Buffered outputs of the block engines are included: a restored state
+ *       continues with exactly the value the original would have returned.
+ * @code{.c}
+ * // Example: Pause a simulation and resume it later
+ * uint8_t ckpt[PRNG_SAVE_MAX];
+ * prng_save(&rng, ckpt, sizeof(ckpt));
+ * fwrite(ckpt, 1, prng_save_size(&rng), file);
+ * ...
+ * fread(ckpt, 1, sizeof(ckpt), file);
+ * prng_load(&rng, ckpt, sizeof(ckpt));
+ * @endcode
+ */
+uint8_t* prng_save(const prng_state_t* state, uint8_t* buf, size_t size);
+
+/**
+ * @brief Restores a PRNG state written by prng_save()
+ * @param state Receives the state (engine included)
+ * @param buf Checkpoint record
+ * @param size Bytes available in buf (may exceed the record)
+ * @return state pointer for chaining, NULL on error (state unchanged)
+ * @throws EINVAL on an unknown version, engine tag or corrupt buffer position
+ * @throws ERANGE if the record is truncated
+ */
+prng_state_t* prng_load(prng_state_t* state, const uint8_t* buf, size_t size);
+
+/**
+ * @brief Bytes prng_save_array() writes for count states
+ * @param states Array of initialized states (engines may differ)
+ * @param count Number of states
+ * @return PRNG_SAVE_ARRAY_HEADER plus the sum of the record sizes, 0 if that
+ *         overflows size_t (e.g. past 64KB on a 16-bit target)
+ */
+size_t prng_save_array_size(const prng_state_t* states, size_t count);
+
+/**
+ * @brief Checkpoints an array of states (e.g. one per worker) into one buffer
+ * @param states Array of initialized states
+ * @param count Number of states
+ * @param buf Destination buffer
+ * @param size Capacity of buf in bytes
+ * @return buf pointer for chaining, NULL if buf is too small
+ * @throws ERANGE if size < prng_save_array_size(states, count), or that size
+ *         overflows (buf unchanged); checkpoint such arrays in slices
+ * @note Layout: PRNG_SAVE_VERSION byte, PRNG_SAVE_ARRAY_TAG byte, the count as
+ *       a little-endian u32, then one prng_save() record per state.
+ * @code{.c}
+ * // Example: Checkpoint every worker stream with a single write
+ * size_t bytes = prng_save_array_size(workers, n);
+ * uint8_t* ckpt = malloc(bytes);
+ * prng_save_array(workers, n, ckpt, bytes);
+ * fwrite(ckpt, 1, bytes, file);
+ * @endcode
+ */
+uint8_t* prng_save_array(const prng_state_t* states, size_t count, uint8_t* buf, size_t size);
+
+/**
+ * @brief Restores an array of states written by prng_save_array()
+ * @param states Receives count states
+ * @param count Number of states expected in the checkpoint
+ * @param buf Bulk checkpoint
+ * @param size Bytes available in buf
+ * @return states pointer for chaining, NULL on error (states unchanged)
+ * @throws EINVAL on a bad header, a count mismatch or an invalid record
+ * @throws ERANGE if the checkpoint is truncated
+ */
+prng_state_t* prng_load_array(prng_state_t* states, size_t count, const uint8_t* buf, size_t size);
+
 /**
  * @brief Dumps PRNG state in compact single-line format
  * @param state Initialized PRNG state (must not be NULL)
@@ -277,6 +687,7 @@ uint32_t prng_range_exact(prng_state_t* state, uint32_t min, uint32_t max);
  * // [PRNG] Marsaglia's MWC State:a=0x12345678 b=0x9ABCDEF0
  * // [PRNG] PCG32 State:0x4D3C0A3B00000001 Seq:0x0001
  * @endcode
+ * @note Human-readable and partial; use prng_save() for an exact checkpoint.
  */
 void prng_dump(const prng_state_t* state, FILE* output);
 
@@ -1,14 +1,21 @@
 #ifndef PRNG_CONSTANTS_H
 #define PRNG_CONSTANTS_H
 
-#define PRNG_ENGINE_COUNT   5
+#define PRNG_ENGINE_COUNT   12
 
 const char prng_to_string[PRNG_ENGINE_COUNT][31] = {
     "Marsaglia's MWC",
     "XORShift128**",
     "Standard C99",
     "PCG32",
-    "SplitMix64"
+    "SplitMix64",
+    "Xoshiro128+ x4",
+    "Xoshiro128+ x8",
+    "Philox4x32-10",
+    "Xoshiro256**",
+    "Xoshiro256+",
+    "Wyrand",
+    "SFC64"
 };
 
 /* ===================== *
@@ -54,6 +61,15 @@ const char prng_to_string[PRNG_ENGINE_COUNT][31] = {
 #define XORSHIFT_SHIFT_1    11U
 #define XORSHIFT_SHIFT_2    8U
 #define XORSHIFT_SHIFT_3    19U
+// Characteristic polynomial of the step, low 128 coefficients (x^128 implied), used for jumps
+#define XORSHIFT_CHARPOLY   {0xFD3C8001U, 0xF985D65FU, 0x0046D8B3U, 0x00000001U}
+
+// C99 rand() - the ISO C reference implementation
+#define C99_LCG_MULTIPLIER  1103515245U
+#define C99_LCG_INCREMENT   12345U
+#define C99_LCG_SHIFT       16U
+#define C99_RAND_MAX        0x7FFFU
+#define C99_RAND_BITS       15U
 
 // PCG32
 #define PCG_MULTIPLIER      6364136223846793005ULL
@@ -69,8 +85,54 @@ const char prng_to_string[PRNG_ENGINE_COUNT][31] = {
 #define SPLITMIX_SHIFT_1    30U
 #define SPLITMIX_SHIFT_2    27U
 
+// Multi-lane Xoshiro128+
+#define PRNG_LANES_MAX      8       // Widest lane engine (state arrays are sized for it)
+#define XOSHIRO_SHIFT       9U
+#define XOSHIRO_ROTATE      11U
+#define XOSHIRO_CHARPOLY    {0xDE18FC01U, 0x1B489DB6U, 0x006254B1U, 0x00FC65A2U}
+
+// Philox4x32-10
+#define PHILOX_M0           0xD2511F53U
+#define PHILOX_M1           0xCD9E8D57U
+#define PHILOX_W0           0x9E3779B9U     // Key schedule (golden ratio)
+#define PHILOX_W1           0xBB67AE85U     // Key schedule (sqrt(3) - 1)
+#define PHILOX_ROUNDS       10U
+#define PHILOX_BLOCK        4U              // Outputs per counter value
+
+// Xoshiro256** / Xoshiro256+
+#define XOSHIRO256_SHIFT    17U
+#define XOSHIRO256_ROTATE   45U
+#define XOSHIRO256SS_MULT_1 5U      // ** scrambler: rotl(s1 * 5, 7) * 9
+#define XOSHIRO256SS_ROTATE 7U
+#define XOSHIRO256SS_MULT_2 9U
+#define XOSHIRO256_CHARPOLY {0xB0F0F001U, 0x9D116F2BU, 0xCEFD1A5EU, 0x0280002BU, \
+                             0x26259F85U, 0x04B4EDCFU, 0x3F3ECB19U, 0x0003C03CU}
+
+// Wyrand
+#define WYRAND_INCREMENT    0xA0761D6478BD642FULL
+#define WYRAND_XOR          0xE7037ED1A0B428DBULL
+
+// SFC64 (Chris Doty-Humphrey's Small Fast Chaotic)
+#define SFC64_RSHIFT        11U
+#define SFC64_LSHIFT        3U
+#define SFC64_ROTATE        24U
+#define SFC64_WARMUP        12      // Discarded outputs after seeding
+
+// Jump distances (log2 of the steps skipped by prng_jump())
+#define PRNG_JUMP_LOG2_256  128U    // 2^256-1 period engines: 2^128 substreams of 2^128
+#define PRNG_JUMP_LOG2_128  64U     // 2^128-1 period engines: 2^64 substreams of 2^64
+#define PRNG_JUMP_LOG2_64   48U     // 2^64 period engines: 2^16 substreams of 2^48
+
+// Binary checkpoints (prng_save / prng_load)
+#define PRNG_SAVE_VERSION       1U
+#define PRNG_SAVE_HEADER        2U      // Version byte + engine tag
+#define PRNG_SAVE_MAX           166U    // Largest record: 8-lane Xoshiro128+ (41 words)
+#define PRNG_SAVE_ARRAY_TAG     0xFFU   // Engine tag slot of a bulk header
+#define PRNG_SAVE_ARRAY_HEADER  6U      // Version byte, array tag, u32 state count
+
 // Float generation
 #define FLOAT_2POW32        4294967296.0
 #define FLOAT_INV_2POW32    1.0 / FLOAT_2POW32
+#define FLOAT_INV_2POW53    (1.0 / 9007199254740992.0)   // 53-bit doubles from the top of a u64
 
 #endif
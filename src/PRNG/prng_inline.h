@@ -0,0 +1,215 @@
+#ifndef PRNG_INLINE_H
+#define PRNG_INLINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "prng_constants.h"
+
+/**
+ * @file prng_inline.h
+ * @brief Per-engine state types and fully inlined generators
+ *
+ * prng_next_u32() switches on the engine and is an out-of-line call. Code that
+ * knows its engine at compile time can instead run that engine's own state
+ * struct through the static inline functions below: no dispatch, and the
+ * state stays in registers across a hot loop.
+ *
+ * The generic prng_state_t holds these same structs in its union, so prng_init()
+ * seeds them and the values are identical to the generic API.
+ *
+ * @code{.c}
+ * prng_state_t rng;
+ * prng_init(&rng, PRNG_PCG32, 0xC0FFEE, 0, NULL);
+ *
+ * prng_pcg32_t pcg = rng.state.pcg;     // take the typed state out
+ * for (int i = 0; i < n; i++) {
+ *     x[i] = prng_pcg32_next_float(&pcg);  // inlined, no switch
+ * }
+ * rng.state.pcg = pcg;                  // hand it back to the generic API
+ * @endcode
+ */
+
+// ========================
+// State types
+// ========================
+
+/** Marsaglia's MWC (c and d are reserved) */
+typedef struct { uint32_t a, b, c, d; } prng_mwc_t;
+
+/** XORShift128**, x[0] is the newest word */
+typedef struct { uint32_t x[4]; } prng_xorshift_t;
+
+/** PCG32 XSH-RR (inc is the stream selector, PCG_INCREMENT by default) */
+typedef struct { uint64_t state; uint64_t inc; } prng_pcg32_t;
+
+/** SplitMix64 counter */
+typedef struct { uint64_t x; } prng_splitmix_t;
+
+/** Xoshiro256 state, shared by the ** and + scramblers */
+typedef struct { uint64_t s[4]; } prng_xoshiro256_t;
+typedef prng_xoshiro256_t prng_xoshiro256ss_t;
+typedef prng_xoshiro256_t prng_xoshiro256p_t;
+
+/** Wyrand counter */
+typedef struct { uint64_t x; } prng_wyrand_t;
+
+/** SFC64: three chaotic words and a counter */
+typedef struct { uint64_t a, b, c, counter; } prng_sfc64_t;
+
+// ========================
+// Engine steps
+// ========================
+
+static inline uint32_t prng_mwc_next_u32(prng_mwc_t* s) {
+    s->a = s->a * MWC_MULTIPLIER_A + (s->a >> 16);
+    s->b = s->b * MWC_MULTIPLIER_B + (s->b >> 16);
+    return (s->a << 16) + s->b;
+}
+
+static inline uint32_t prng_xorshift_next_u32(prng_xorshift_t* s) {
+    uint32_t t = s->x[3];
+    t ^= t << XORSHIFT_SHIFT_1;
+    t ^= t >> XORSHIFT_SHIFT_2;
+    s->x[3] = s->x[2];
+    s->x[2] = s->x[1];
+    s->x[1] = s->x[0];
+    t ^= s->x[0];
+    t ^= s->x[0] >> XORSHIFT_SHIFT_3;
+    s->x[0] = t;
+    return t;
+}
+
+static inline uint32_t prng_pcg32_next_u32(prng_pcg32_t* s) {
+    const uint64_t oldstate = s->state;
+    s->state = oldstate * PCG_MULTIPLIER + PCG_INCREMENT;
+    const uint32_t xorshifted = (uint32_t)(((oldstate >> (64 - PCG_ROTATE_BITS)) ^ oldstate) >> PCG_XSHIFT_BITS);
+    const uint32_t rot = (uint32_t)(oldstate >> PCG_ROTATE_BITS);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & PCG_OUTPUT_BITS));
+}
+
+/** Native 64-bit SplitMix64 output (one step) */
+static inline uint64_t prng_splitmix_next_u64(prng_splitmix_t* s) {
+    uint64_t z = (s->x += SPLITMIX_INCREMENT);
+    z = (z ^ (z >> SPLITMIX_SHIFT_1)) * SPLITMIX_MULT_1;
+    z = (z ^ (z >> SPLITMIX_SHIFT_2)) * SPLITMIX_MULT_2;
+    return z;
+}
+
+/** High half of one SplitMix64 step */
+static inline uint32_t prng_splitmix_next_u32(prng_splitmix_t* s) {
+    return (uint32_t)(prng_splitmix_next_u64(s) >> 32);
+}
+
+static inline uint64_t prng_rotl64(uint64_t x, unsigned k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/** 64x64 -> 128-bit product folded to 64 bits (hi ^ lo), without a 128-bit type */
+static inline uint64_t prng_mum64(uint64_t a, uint64_t b) {
+    const uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    const uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    const uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi;
+    const uint64_t hl = a_hi * b_lo, hh = a_hi * b_hi;
+    const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    const uint64_t lo = (mid << 32) | (uint32_t)ll;
+    const uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return hi ^ lo;
+}
+
+/** Linear engine of xoshiro256 (the scramblers read the state before it) */
+static inline void prng_xoshiro256_step(prng_xoshiro256_t* s) {
+    const uint64_t t = s->s[1] << XOSHIRO256_SHIFT;
+    s->s[2] ^= s->s[0];
+    s->s[3] ^= s->s[1];
+    s->s[1] ^= s->s[2];
+    s->s[0] ^= s->s[3];
+    s->s[2] ^= t;
+    s->s[3] = prng_rotl64(s->s[3], XOSHIRO256_ROTATE);
+}
+
+static inline uint64_t prng_xoshiro256ss_next_u64(prng_xoshiro256ss_t* s) {
+    const uint64_t r = prng_rotl64(s->s[1] * XOSHIRO256SS_MULT_1, XOSHIRO256SS_ROTATE) * XOSHIRO256SS_MULT_2;
+    prng_xoshiro256_step(s);
+    return r;
+}
+
+static inline uint64_t prng_xoshiro256p_next_u64(prng_xoshiro256p_t* s) {
+    const uint64_t r = s->s[0] + s->s[3];
+    prng_xoshiro256_step(s);
+    return r;
+}
+
+static inline uint64_t prng_wyrand_next_u64(prng_wyrand_t* s) {
+    s->x += WYRAND_INCREMENT;
+    return prng_mum64(s->x, s->x ^ WYRAND_XOR);
+}
+
+static inline uint64_t prng_sfc64_next_u64(prng_sfc64_t* s) {
+    const uint64_t tmp = s->a + s->b + s->counter++;
+    s->a = s->b ^ (s->b >> SFC64_RSHIFT);
+    s->b = s->c + (s->c << SFC64_LSHIFT);
+    s->c = prng_rotl64(s->c, SFC64_ROTATE) + tmp;
+    return tmp;
+}
+
+// 32-bit output of the native 64-bit engines: the high half of one step
+static inline uint32_t prng_xoshiro256ss_next_u32(prng_xoshiro256ss_t* s) {
+    return (uint32_t)(prng_xoshiro256ss_next_u64(s) >> 32);
+}
+
+static inline uint32_t prng_xoshiro256p_next_u32(prng_xoshiro256p_t* s) {
+    return (uint32_t)(prng_xoshiro256p_next_u64(s) >> 32);
+}
+
+static inline uint32_t prng_wyrand_next_u32(prng_wyrand_t* s) {
+    return (uint32_t)(prng_wyrand_next_u64(s) >> 32);
+}
+
+static inline uint32_t prng_sfc64_next_u32(prng_sfc64_t* s) {
+    return (uint32_t)(prng_sfc64_next_u64(s) >> 32);
+}
+
+// ========================
+// Derived front end
+// ========================
+
+/**
+ * Generates, for each engine:
+ * - prng_<name>_next_float(s)            [0,1), same as prng_next_float()
+ * - prng_<name>_fill_u32(s, out, count)  same as prng_fill_u32(), returns out
+ * - prng_<name>_fill_double(s, out, count) same as prng_fill_double(), returns out
+ */
+#define PRNG_DEFINE_INLINE(name)                                                        \
+    static inline double prng_##name##_next_float(prng_##name##_t* s) {                 \
+        return prng_##name##_next_u32(s) * FLOAT_INV_2POW32;                            \
+    }                                                                                   \
+    static inline uint32_t* prng_##name##_fill_u32(prng_##name##_t* s, uint32_t* out,   \
+                                                   size_t count) {                      \
+        prng_##name##_t local = *s;                                                     \
+        for (size_t i = 0; i < count; i++) {                                            \
+            out[i] = prng_##name##_next_u32(&local);                                    \
+        }                                                                               \
+        *s = local;                                                                     \
+        return out;                                                                     \
+    }                                                                                   \
+    static inline double* prng_##name##_fill_double(prng_##name##_t* s, double* out,    \
+                                                    size_t count) {                     \
+        prng_##name##_t local = *s;                                                     \
+        for (size_t i = 0; i < count; i++) {                                            \
+            out[i] = prng_##name##_next_u32(&local) * FLOAT_INV_2POW32;                 \
+        }                                                                               \
+        *s = local;                                                                     \
+        return out;                                                                     \
+    }
+
+PRNG_DEFINE_INLINE(mwc)
+PRNG_DEFINE_INLINE(xorshift)
+PRNG_DEFINE_INLINE(pcg32)
+PRNG_DEFINE_INLINE(splitmix)
+PRNG_DEFINE_INLINE(xoshiro256ss)
+PRNG_DEFINE_INLINE(xoshiro256p)
+PRNG_DEFINE_INLINE(wyrand)
+PRNG_DEFINE_INLINE(sfc64)
+
+#endif // PRNG_INLINE_H
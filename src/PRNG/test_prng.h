@@ -2,8 +2,10 @@
 #define TEST_PRNGS_H
 
 #include <stdbool.h>
+#include <errno.h>
 #include <math.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "../PRNG/prng.h"
 #include "../PRNG/prng_popcount.h"
@@ -37,7 +39,28 @@
 #define PRNG_TEST_RANGE &test_prng_range_u32_basic, \
     &test_prng_range_u32_bias_check, \
     &test_prng_range_exact_uniformity, \
-    &test_prng_range_exact_edge_cases
+    &test_prng_range_exact_edge_cases, \
+    &test_prng_fill_range_u32
+
+#define PRNG_TEST_BULK &test_prng_fill_matches_next, \
+        &test_prng_lanes_seeding, \
+        &test_prng_inline_matches_generic, \
+        &test_prng_u64_and_double53, \
+        &test_prng_c99_reentrant
+
+#define PRNG_TEST_JUMP &test_prng_advance_matches_next, \
+        &test_prng_split_disjoint
+
+#define PRNG_TEST_PHILOX &test_prng_philox_known_answers, \
+        &test_prng_philox_seek
+
+#define PRNG_TEST_ENGINES64 &test_prng_engines64_known_answers, \
+        &test_prng_xoshiro256_jump
+
+#define PRNG_TEST_CHECKPOINT &test_prng_save_load_roundtrip, \
+        &test_prng_save_layout, \
+        &test_prng_load_rejects, \
+        &test_prng_save_array
 
 // =============================================
 // Test Cases
@@ -49,7 +72,14 @@ TEST(test_prng_float_basic) {
         {0.316972, 0.309092},  // XORShift128**
         {0.000001, 0.000003},  // C99 (adjust based on your implementation)
         {0.000000, 0.424801},  // PCG32
-        {0.292476, 0.868537}   // SplitMix
+        {0.292476, 0.868537},  // SplitMix
+        {0.858628, 0.994298},  // Xoshiro128+ x4
+        {0.858628, 0.994298},  // Xoshiro128+ x8 (lanes 0-3 match x4)
+        {0.791756, 0.374603},  // Philox4x32-10
+        {0.770833, 0.397506},  // Xoshiro256**
+        {0.747170, 0.522090},  // Xoshiro256+
+        {0.100290, 0.323514},  // Wyrand
+        {0.066447, 0.679638}   // SFC64
     };
 
     for (size_t i = 0; i < PRNG_ENGINE_COUNT; i++) {
@@ -74,7 +104,7 @@ TEST(test_prng_float_basic) {
 TEST(test_prng_float_distribution) {
     const size_t num_buckets = 32;
     const size_t samples = 10000;
-    const double chi2_threshold = 36.0; // 95% CI for 31 DOF
+    const double chi2_threshold = 44.985; // chi2 critical value, 31 DOF, p = 0.05
 
     for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
         prng_state_t rng;
@@ -103,7 +133,8 @@ TEST(test_prng_float_distribution) {
 
 TEST(test_prng_float_monte_carlo) {
     const size_t samples = 10000;
-    const double max_error = 1.0; // Max 1% error
+    // 3 sigma of the binomial hit count (p = pi/4), as a percentage of pi
+    const double max_error = 300.0 * 4.0 * sqrt(M_PI / 4.0 * (1.0 - M_PI / 4.0) / samples) / M_PI;
 
     for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
         prng_state_t rng;
@@ -150,12 +181,19 @@ struct {
 }
 
 TEST(test_prng_basic) {
-    const uint32_t expected[10] = {
+    const uint32_t expected[PRNG_ENGINE_COUNT * 2] = {
         3073780141, 2828037266,
         1361383432, 1327541568,
         5720, 14404,
         27, 1824507900,
-        1256175887, 3730336304
+        1256175887, 3730336304,
+        3687777204, 4270478005,
+        3687777204, 4270478005,
+        3400566673, 1608908675,
+        3310702142, 1707275303,
+        3209070467, 2242359956,
+        430742698, 1389483662,
+        285388575, 2919024562
     };
 
     for (size_t i = 0; i < PRNG_ENGINE_COUNT; i++) {
@@ -209,6 +247,8 @@ TEST(test_prng_distributions) {
 
 TEST(test_prng_monte_carlo) {
     const size_t samples = 100;
+    // 3 sigma of the binomial hit count (p = pi/4), as a percentage of pi
+    const double max_error = 300.0 * 4.0 * sqrt(M_PI / 4.0 * (1.0 - M_PI / 4.0) / samples) / M_PI;
 
     for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
         prng_state_t rng;
@@ -229,7 +269,7 @@ TEST(test_prng_monte_carlo) {
         double pi_est = 4.0 * hits / samples;
         double error = fabs(pi_est - M_PI) / M_PI * 100.0;
         V(printf(" err %f %s\n", error, prng_to_string[e]););
-        EXPECT_IN_RANGE(error, 0.0, 7.0);
+        EXPECT_IN_RANGE(error, 0.0, max_error);
     }
 }
 
@@ -400,4 +440,471 @@ TEST(test_prng_range_exact_edge_cases) {
     EXPECT_LT(val, UINT32_MAX);
 }
 
+TEST(test_prng_fill_matches_next) {
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        prng_state_t bulk, single;
+        prng_init(&bulk, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+        prng_init(&single, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+
+        uint32_t words[37];
+        double floats[37];
+        uint64_t wide[5];
+        prng_fill_u32(&bulk, words, 37);
+        prng_fill_double(&bulk, floats, 37);
+        prng_fill_u64(&bulk, wide, 5);
+
+        for (size_t i = 0; i < 37; i++) {
+            EXPECT_EQ(words[i], prng_next_u32(&single));
+        }
+        for (size_t i = 0; i < 37; i++) {
+            EXPECT_EQ(floats[i], prng_next_float(&single));
+        }
+        for (size_t i = 0; i < 5; i++) {
+            if (prng_engine_list[e] == PRNG_SPLITMIX || prng_engine_list[e] >= PRNG_XOSHIRO256SS) {
+                EXPECT_EQ(wide[i] >> 32, prng_next_u32(&single)); // one native step per value
+            } else if (prng_engine_list[e] == PRNG_C99) {
+                uint64_t joined = 0;
+                for (size_t k = 0; k < 5; k++) {
+                    joined = (joined << C99_RAND_BITS) | prng_next_u32(&single);
+                }
+                EXPECT_EQ(wide[i], joined);
+            } else {
+                const uint64_t hi = prng_next_u32(&single);
+                EXPECT_EQ(wide[i], (hi << 32) | prng_next_u32(&single));
+            }
+        }
+    }
+}
+
+TEST(test_prng_lanes_seeding) {
+    // Lanes are seeded in order from one SplitMix64 sequence, so the first four
+    // lanes of the 8-wide engine replay the 4-wide engine lane for lane
+    prng_state_t x4, x8;
+    prng_init(&x4, PRNG_XOSHIRO128P_X4, 0xDEADBEEF, 16, NULL);
+    prng_init(&x8, PRNG_XOSHIRO128P_X8, 0xDEADBEEF, 16, NULL);
+
+    // An empty buffer is marked by pos == lane count, never past it
+    prng_state_t fresh;
+    prng_init(&fresh, PRNG_XOSHIRO128P_X4, 0xDEADBEEF, 0, NULL);
+    EXPECT_EQ(fresh.state.lanes.pos, 4U);
+    prng_jump(&fresh);
+    EXPECT_EQ(fresh.state.lanes.pos, 4U);
+
+    uint32_t a[4 * 25], b[8 * 25];
+    prng_fill_u32(&x4, a, 4 * 25);
+    prng_fill_u32(&x8, b, 8 * 25);
+    for (size_t block = 0; block < 25; block++) {
+        for (size_t lane = 0; lane < 4; lane++) {
+            EXPECT_EQ(a[block * 4 + lane], b[block * 8 + lane]);
+        }
+    }
+
+    // Different seeds give different lanes
+    prng_init(&x4, PRNG_XOSHIRO128P_X4, 0xDEADBEF0, 16, NULL);
+    EXPECT_NEQ(prng_next_u32(&x4), a[0]);
+}
+
+TEST(test_prng_advance_matches_next) {
+    const uint64_t deltas[] = {0, 1, 3, 8, 13, 1000};
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        for (size_t d = 0; d < sizeof(deltas) / sizeof(deltas[0]); d++) {
+            prng_state_t jumped, stepped;
+            prng_init(&jumped, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+            prng_init(&stepped, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+
+            // Start mid-block so the lane engines cover the buffered path
+            prng_next_u32(&jumped);
+            prng_next_u32(&stepped);
+
+            prng_advance(&jumped, deltas[d]);
+            for (uint64_t i = 0; i < deltas[d]; i++) {
+                prng_next_u32(&stepped);
+            }
+            for (size_t i = 0; i < 10; i++) {
+                EXPECT_EQ(prng_next_u32(&jumped), prng_next_u32(&stepped));
+            }
+        }
+    }
+}
+
+TEST(test_prng_split_disjoint) {
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        prng_state_t parent, child, reference;
+        prng_init(&parent, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+        reference = parent;
+
+        if (prng_engine_list[e] == PRNG_MARSAGLIA || prng_engine_list[e] == PRNG_C99 ||
+            prng_engine_list[e] == PRNG_SFC64) {
+            errno = 0;
+            EXPECT_TRUE(prng_split(&parent, &child) == NULL);
+            EXPECT_EQ(errno, EINVAL);
+            continue;
+        }
+        EXPECT_TRUE(prng_split(&parent, &child) == &child);
+
+        // The child takes over the parent's position, the parent moves on
+        uint32_t first = prng_next_u32(&child);
+        EXPECT_EQ(first, prng_next_u32(&reference));
+        EXPECT_NEQ(prng_next_u32(&parent), first);
+    }
+
+    // Jumping by the distance directly agrees with the split parent
+    prng_state_t a, b;
+    prng_init(&a, PRNG_PCG32, 0xDEADBEEF, 16, NULL);
+    prng_init(&b, PRNG_PCG32, 0xDEADBEEF, 16, NULL);
+    prng_jump(&a);
+    prng_advance(&b, (uint64_t)1 << PRNG_JUMP_LOG2_64);
+    EXPECT_EQ(prng_next_u32(&a), prng_next_u32(&b));
+}
+
+TEST(test_prng_philox_known_answers) {
+    // Random123 kat_vectors, philox4x32 with 10 rounds
+    const uint32_t keys[3][2] = {
+        {0x00000000, 0x00000000},
+        {0xFFFFFFFF, 0xFFFFFFFF},
+        {0xA4093822, 0x299F31D0}
+    };
+    const uint32_t counters[3][4] = {
+        {0x00000000, 0x00000000, 0x00000000, 0x00000000},
+        {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+        {0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344}
+    };
+    const uint32_t expected[3][4] = {
+        {0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8},
+        {0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD},
+        {0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1}
+    };
+
+    for (size_t i = 0; i < 3; i++) {
+        uint32_t out[4];
+        prng_philox_block(keys[i], counters[i], out);
+        for (size_t w = 0; w < 4; w++) {
+            EXPECT_EQ(out[w], expected[i][w]);
+        }
+    }
+}
+
+TEST(test_prng_philox_seek) {
+    const uint64_t seed = 0x0123456789ABCDEFULL;
+    const uint32_t key[2] = {(uint32_t)seed, (uint32_t)(seed >> 32)};
+    prng_state_t rng;
+    prng_init(&rng, PRNG_PHILOX4X32, seed, 0, NULL);
+
+    // Output is the block for (key, counter), whatever happened before the seek
+    prng_next_u32(&rng);
+    EXPECT_TRUE(prng_philox_seek(&rng, 7, 0xFFFFFFFFFFFFFFFFULL) == &rng);
+
+    const uint32_t counter[4] = {0xFFFFFFFF, 0xFFFFFFFF, 7, 0};
+    const uint32_t next[4] = {0, 0, 8, 0}; // carry into the high half
+    uint32_t block[4];
+    prng_philox_block(key, counter, block);
+    for (size_t w = 0; w < 4; w++) {
+        EXPECT_EQ(prng_next_u32(&rng), block[w]);
+    }
+    prng_philox_block(key, next, block);
+    EXPECT_EQ(prng_next_u32(&rng), block[0]);
+
+    // Seeking is Philox-only
+    prng_state_t other;
+    prng_init(&other, PRNG_PCG32, seed, 0, NULL);
+    errno = 0;
+    EXPECT_TRUE(prng_philox_seek(&other, 0, 0) == NULL);
+    EXPECT_EQ(errno, EINVAL);
+}
+
+TEST(test_prng_inline_matches_generic) {
+    prng_state_t mwc, xs, pcg, sm;
+    prng_init(&mwc, PRNG_MARSAGLIA, 0xDEADBEEF, 16, NULL);
+    prng_init(&xs, PRNG_XORSHIFT, 0xDEADBEEF, 16, NULL);
+    prng_init(&pcg, PRNG_PCG32, 0xDEADBEEF, 16, NULL);
+    prng_init(&sm, PRNG_SPLITMIX, 0xDEADBEEF, 16, NULL);
+
+    prng_mwc_t fast_mwc = mwc.state.mwc;
+    prng_xorshift_t fast_xs = xs.state.xorshift;
+    prng_pcg32_t fast_pcg = pcg.state.pcg;
+    prng_splitmix_t fast_sm = sm.state.splitmix;
+
+    for (size_t i = 0; i < 20; i++) {
+        EXPECT_EQ(prng_mwc_next_u32(&fast_mwc), prng_next_u32(&mwc));
+        EXPECT_EQ(prng_xorshift_next_u32(&fast_xs), prng_next_u32(&xs));
+        EXPECT_EQ(prng_pcg32_next_float(&fast_pcg), prng_next_float(&pcg));
+        EXPECT_EQ(prng_splitmix_next_u32(&fast_sm), prng_next_u32(&sm));
+    }
+
+    uint32_t fast[17], generic[17];
+    prng_pcg32_fill_u32(&fast_pcg, fast, 17);
+    prng_fill_u32(&pcg, generic, 17);
+    for (size_t i = 0; i < 17; i++) {
+        EXPECT_EQ(fast[i], generic[i]);
+    }
+
+    // The typed state goes back into the generic handle unchanged
+    pcg.state.pcg = fast_pcg;
+    EXPECT_EQ(prng_next_u32(&pcg), prng_pcg32_next_u32(&fast_pcg));
+}
+
+TEST(test_prng_fill_range_u32) {
+    prng_state_t bulk, single;
+    prng_init(&bulk, PRNG_PCG32, 0xDEADBEEF, 0, NULL);
+    prng_init(&single, PRNG_PCG32, 0xDEADBEEF, 0, NULL);
+
+    // Small range: a rejection needs a low word below 4, so the batch equals
+    // the one-at-a-time sequence
+    uint32_t dice[64];
+    prng_fill_range_u32(&bulk, dice, 64, 1, 6);
+    for (size_t i = 0; i < 64; i++) {
+        EXPECT_EQ(dice[i], prng_range_exact(&single, 1, 6));
+    }
+
+    // Range just above 2^31: almost half of all draws are rejected
+    const uint32_t range = 0x80000001U;
+    uint32_t wide[4000];
+    size_t upper = 0;
+    prng_fill_range_u32(&bulk, wide, 4000, 5, 5 + range - 1);
+    for (size_t i = 0; i < 4000; i++) {
+        EXPECT_GTE(wide[i], 5U);
+        EXPECT_LTE(wide[i], 5 + range - 1);
+        upper += wide[i] - 5 >= range / 2;
+    }
+    // Modulo reduction would put only ~1/3 of the values in the upper half
+    EXPECT_GT(upper, 1800U);
+    EXPECT_LT(upper, 2200U);
+
+    // Full range passes the raw words through
+    uint32_t raw[8];
+    prng_init(&bulk, PRNG_PCG32, 7, 0, NULL);
+    prng_init(&single, PRNG_PCG32, 7, 0, NULL);
+    prng_fill_range_u32(&bulk, raw, 8, 0, UINT32_MAX);
+    for (size_t i = 0; i < 8; i++) {
+        EXPECT_EQ(raw[i], prng_next_u32(&single));
+    }
+}
+
+TEST(test_prng_u64_and_double53) {
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        prng_state_t bulk, single;
+        prng_init(&bulk, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+        prng_init(&single, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+
+        uint64_t wide[9];
+        double fine[70];
+        prng_fill_u64(&bulk, wide, 9);
+        prng_fill_double53(&bulk, fine, 70); // crosses one internal chunk
+        for (size_t i = 0; i < 9; i++) {
+            EXPECT_EQ(wide[i], prng_next_u64(&single));
+        }
+
+        size_t below_2pow32_grid = 0;
+        for (size_t i = 0; i < 70; i++) {
+            const double u = prng_next_double53(&single);
+            EXPECT_EQ(fine[i], u);
+            EXPECT_GTE(u, 0.0);
+            EXPECT_LT(u, 1.0);
+            // Bits below 2^-32 are set, which prng_next_float() never does
+            below_2pow32_grid += (u * FLOAT_2POW32 != floor(u * FLOAT_2POW32));
+        }
+        EXPECT_GT(below_2pow32_grid, 60U);
+
+        // Every bit position varies, including for the 15-bit C99 engine
+        uint64_t any = 0, all = UINT64_MAX;
+        for (size_t i = 0; i < 64; i++) {
+            const uint64_t v = prng_next_u64(&single);
+            any |= v;
+            all &= v;
+        }
+        EXPECT_EQ(any, UINT64_MAX);
+        EXPECT_EQ(all, 0ULL);
+    }
+}
+
+TEST(test_prng_c99_reentrant) {
+    // ISO C reference rand() after srand(0xBEEF), as on a 16-bit unsigned int
+    prng_state_t a, b;
+    prng_init(&a, PRNG_C99, 0xBEEF, 0, NULL);
+    prng_init(&b, PRNG_C99, 0xBEEF, 0, NULL);
+
+    // Interleaved handles no longer disturb each other
+    EXPECT_EQ(prng_next_u32(&a), 5720U);
+    EXPECT_EQ(prng_next_u32(&b), 5720U);
+    EXPECT_EQ(prng_next_u32(&b), 14404U);
+    EXPECT_EQ(prng_next_u32(&a), 14404U);
+
+    for (size_t i = 0; i < 1000; i++) {
+        EXPECT_LTE(prng_next_u32(&a), C99_RAND_MAX);
+    }
+}
+
+TEST(test_prng_engines64_known_answers) {
+    // Reference outputs of the published algorithms
+    prng_xoshiro256ss_t ss = {{1, 2, 3, 4}};
+    EXPECT_EQ(prng_xoshiro256ss_next_u64(&ss), 11520ULL);
+    EXPECT_EQ(prng_xoshiro256ss_next_u64(&ss), 0ULL);
+    EXPECT_EQ(prng_xoshiro256ss_next_u64(&ss), 1509978240ULL);
+
+    prng_xoshiro256p_t p = {{1, 2, 3, 4}};
+    EXPECT_EQ(prng_xoshiro256p_next_u64(&p), 5ULL);
+    EXPECT_EQ(prng_xoshiro256p_next_u64(&p), 211106232532999ULL);
+    EXPECT_EQ(prng_xoshiro256p_next_u64(&p), 211106635186183ULL);
+
+    prng_wyrand_t wy = {1};
+    EXPECT_EQ(prng_wyrand_next_u64(&wy), 14839104130206199084ULL);
+    EXPECT_EQ(prng_wyrand_next_u64(&wy), 7050053486739369280ULL);
+
+    // SFC64 seeded with 1 in all three words, after the 12 warm-up outputs
+    prng_state_t sfc;
+    prng_init(&sfc, PRNG_SFC64, 1, 0, NULL);
+    EXPECT_EQ(prng_next_u64(&sfc), 4575600246886300555ULL);
+    EXPECT_EQ(prng_next_u64(&sfc), 2331226524683249810ULL);
+}
+
+TEST(test_prng_xoshiro256_jump) {
+    // Blackman & Vigna's jump() polynomial for 2^128 steps
+    const uint64_t jump[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+    prng_state_t rng;
+    prng_init(&rng, PRNG_XOSHIRO256SS, 0xDEADBEEF, 0, NULL);
+
+    prng_xoshiro256_t s = rng.state.xoshiro256;
+    prng_xoshiro256_t acc = {{0, 0, 0, 0}};
+    for (size_t w = 0; w < 4; w++) {
+        for (unsigned b = 0; b < 64; b++) {
+            if (jump[w] >> b & 1) {
+                for (size_t k = 0; k < 4; k++) acc.s[k] ^= s.s[k];
+            }
+            prng_xoshiro256_step(&s);
+        }
+    }
+
+    prng_jump(&rng);
+    for (size_t k = 0; k < 4; k++) {
+        EXPECT_EQ(rng.state.xoshiro256.s[k], acc.s[k]);
+    }
+}
+
+TEST(test_prng_save_load_roundtrip) {
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        prng_state_t rng, restored;
+        prng_init(&rng, prng_engine_list[e], 0xDEADBEEF, 16, NULL);
+        prng_next_u32(&rng); // mid-block for the lane and Philox engines
+        prng_next_u32(&rng);
+        prng_next_u32(&rng);
+
+        uint8_t buf[PRNG_SAVE_MAX];
+        EXPECT_LTE(prng_save_size(&rng), PRNG_SAVE_MAX);
+        EXPECT_TRUE(prng_save(&rng, buf, sizeof(buf)) == buf);
+        EXPECT_TRUE(prng_load(&restored, buf, prng_save_size(&rng)) == &restored);
+        EXPECT_EQ(restored.engine, rng.engine);
+        for (size_t i = 0; i < 40; i++) {
+            EXPECT_EQ(prng_next_u32(&restored), prng_next_u32(&rng));
+        }
+    }
+
+    prng_state_t x8;
+    prng_init(&x8, PRNG_XOSHIRO128P_X8, 1, 0, NULL);
+    EXPECT_EQ(prng_save_size(&x8), PRNG_SAVE_MAX);
+
+    // Fresh and just-split states (empty output buffers) restore as well
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        prng_state_t fresh, child, restored;
+        prng_init(&fresh, prng_engine_list[e], 0xDEADBEEF, 0, NULL);
+
+        uint8_t buf[PRNG_SAVE_MAX];
+        prng_save(&fresh, buf, sizeof(buf));
+        EXPECT_TRUE(prng_load(&restored, buf, sizeof(buf)) == &restored);
+        EXPECT_EQ(prng_next_u32(&restored), prng_next_u32(&fresh));
+
+        if (!prng_split(&fresh, &child)) {
+            continue; // MWC, C99 and SFC64 cannot jump
+        }
+        prng_save(&fresh, buf, sizeof(buf));
+        EXPECT_TRUE(prng_load(&restored, buf, sizeof(buf)) == &restored);
+        for (size_t i = 0; i < 10; i++) {
+            EXPECT_EQ(prng_next_u32(&restored), prng_next_u32(&fresh));
+        }
+    }
+}
+
+TEST(test_prng_save_layout) {
+    prng_state_t rng;
+    prng_init(&rng, PRNG_SPLITMIX, 1, 0, NULL);
+    rng.state.splitmix.x = 0x0102030405060708ULL;
+
+    const uint8_t expected[] = {PRNG_SAVE_VERSION, PRNG_SPLITMIX,
+                                0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
+    uint8_t buf[PRNG_SAVE_MAX];
+    EXPECT_EQ(prng_save_size(&rng), sizeof(expected));
+    prng_save(&rng, buf, sizeof(buf));
+    for (size_t i = 0; i < sizeof(expected); i++) {
+        EXPECT_EQ(buf[i], expected[i]);
+    }
+}
+
+TEST(test_prng_load_rejects) {
+    prng_state_t rng, target;
+    prng_init(&rng, PRNG_PHILOX4X32, 0xDEADBEEF, 0, NULL);
+    prng_init(&target, PRNG_PCG32, 7, 0, NULL);
+    const prng_state_t untouched = target;
+
+    uint8_t buf[PRNG_SAVE_MAX];
+    const size_t len = prng_save_size(&rng);
+
+    errno = 0;
+    EXPECT_TRUE(prng_save(&rng, buf, len - 1) == NULL);
+    EXPECT_EQ(errno, ERANGE);
+    prng_save(&rng, buf, sizeof(buf));
+
+    errno = 0;
+    EXPECT_TRUE(prng_load(&target, buf, len - 1) == NULL);
+    EXPECT_EQ(errno, ERANGE);
+
+    buf[0] = PRNG_SAVE_VERSION + 1;
+    errno = 0;
+    EXPECT_TRUE(prng_load(&target, buf, len) == NULL);
+    EXPECT_EQ(errno, EINVAL);
+    buf[0] = PRNG_SAVE_VERSION;
+
+    buf[1] = PRNG_ENGINE_COUNT;
+    errno = 0;
+    EXPECT_TRUE(prng_load(&target, buf, len) == NULL);
+    EXPECT_EQ(errno, EINVAL);
+    buf[1] = PRNG_PHILOX4X32;
+
+    buf[len - 4] = PHILOX_BLOCK + 1; // buffer position past the block
+    errno = 0;
+    EXPECT_TRUE(prng_load(&target, buf, len) == NULL);
+    EXPECT_EQ(errno, EINVAL);
+
+    EXPECT_EQ(memcmp(&target, &untouched, sizeof(target)), 0);
+}
+
+TEST(test_prng_save_array) {
+    prng_state_t workers[PRNG_ENGINE_COUNT], restored[PRNG_ENGINE_COUNT];
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        prng_init(&workers[e], prng_engine_list[e], 0xC0FFEE + e, 0, NULL);
+        prng_next_u32(&workers[e]);
+    }
+
+    uint8_t buf[PRNG_SAVE_ARRAY_HEADER + PRNG_ENGINE_COUNT * PRNG_SAVE_MAX];
+    const size_t bytes = prng_save_array_size(workers, PRNG_ENGINE_COUNT);
+    EXPECT_LTE(bytes, sizeof(buf));
+    EXPECT_TRUE(prng_save_array(workers, PRNG_ENGINE_COUNT, buf, bytes) == buf);
+
+    // Count mismatch and truncation are refused
+    errno = 0;
+    EXPECT_TRUE(prng_load_array(restored, PRNG_ENGINE_COUNT - 1, buf, bytes) == NULL);
+    EXPECT_EQ(errno, EINVAL);
+    errno = 0;
+    EXPECT_TRUE(prng_load_array(restored, PRNG_ENGINE_COUNT, buf, bytes - 1) == NULL);
+    EXPECT_EQ(errno, ERANGE);
+
+    EXPECT_TRUE(prng_load_array(restored, PRNG_ENGINE_COUNT, buf, bytes) == restored);
+    for (size_t e = 0; e < PRNG_ENGINE_COUNT; e++) {
+        for (size_t i = 0; i < 10; i++) {
+            EXPECT_EQ(prng_next_u32(&restored[e]), prng_next_u32(&workers[e]));
+        }
+    }
+}
+
 #endif
@@ -16,6 +16,7 @@
 #include "stat_central.h"     ///< Central tendency: stat_mean(), stat_median(), stat_mode()
 #include "stat_clamp.h"       ///< Clamping functions: stat_clamp(), stat_clamp_int32(), stat_clamp_array()
 #include "stat_compare.h"     ///< Comparison functions: stat_compare_floats(), stat_almost_equal(), stat_is_near_zero()
+#include "stat_dataset.h"     ///< Cached dataset handle: stat_dataset_init(), stat_dataset_median(), stat_dataset_describe()
 #include "stat_describe.h"    ///< Comprehensive statistics: stat_describe()
 #include "stat_dispersion.h"  ///< Dispersion metrics: stat_variance(), stat_std_dev(), stat_mad(), stat_iqr()
 #include "stat_distributions.h" ///< Distribution generators: stat_generate_uniform_dist(), stat_generate_normal_dist(), stat_generate_exponential_dist()
@@ -24,6 +25,7 @@
 #include "stat_percentiles.h" ///< Percentile functions: stat_percentile(), stat_quartile(), stat_five_num_summary()
 #include "stat_round.h"       ///< Rounding functions: stat_round_to_int32(), stat_floor_to_int32(), stat_ceil_to_int32(), stat_round_decimal()
 #include "stat_sign.h"        ///< Sign functions: stat_sign_float(), stat_sign_int32(), stat_copysign_float()
+#include "stat_stream_hist.h"  ///< Streaming histogram: stat_stream_hist_add_f(), stat_stream_hist_merge(), stat_stream_hist_export()
 #include "stat_util.h"        ///< Utilities: stat_sort(), stat_is_finite(), stat_is_normal()
 
 #endif // STAT_H
@@ -2,10 +2,54 @@
 #include "stat_basic.h"
 #include "stat_percentiles.h"
 #include "stat_round.h"
+#include "stat_util.h"
 #include <math.h>
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
+
+// ========================
+// IEEE-754 log2 bucketing
+// ========================
+
+/** Mantissa bits of an IEEE-754 double */
+#define PRIVATE_DOUBLE_MANTISSA_BITS 52U
+
+// log2(sub_buckets) - the number of top mantissa bits kept in a key
+static unsigned private_log2_bits(stat_size_t sub_buckets) {
+    unsigned bits = 0;
+    assert((sub_buckets & (sub_buckets - 1)) == 0 && "sub_buckets must be a power of two");
+    while (sub_buckets > 1) {
+        sub_buckets >>= 1;
+        bits++;
+    }
+    assert(bits <= 20 && "Too many sub-buckets per octave");
+    return bits;
+}
+
+// Exponent plus top mantissa bits: monotonic in x for finite x > 0
+static uint64_t private_log2_key(stat_float_t x, unsigned bits) {
+    uint64_t u;
+    memcpy(&u, &x, sizeof(u));
+    return u >> (PRIVATE_DOUBLE_MANTISSA_BITS - bits);
+}
+
+// Inverse of private_log2_key: the lower edge of a bucket
+static stat_float_t private_log2_edge(uint64_t key, unsigned bits) {
+    const uint64_t u = key << (PRIVATE_DOUBLE_MANTISSA_BITS - bits);
+    stat_float_t x;
+    memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+stat_size_t stat_binning_log2_count(stat_float_t min, stat_float_t max, stat_size_t sub_buckets) {
+    assert(min > 0 && "BIN_LOG2 needs a positive minimum");
+    assert(max >= min && "Invalid range");
+
+    const unsigned bits = private_log2_bits(sub_buckets ? sub_buckets : 1);
+    return (stat_size_t)(private_log2_key(max, bits) - private_log2_key(min, bits) + 1);
+}
 
 // Updated implementation using your rounding functions
 void stat_binning_calculate_edges(stat_binning_config_t* config, stat_binning_strategy_t strategy)  {
@@ -14,6 +58,8 @@ void stat_binning_calculate_edges(stat_binning_config_t* config, stat_binning_st
     assert(config->count > 0 && "Must have at least 1 bin");
     assert(config->max > config->min && "Invalid range");
 
+    config->strategy = strategy;
+
     switch (strategy) {
         case BIN_LINEAR: {
             const stat_float_t step = (config->max - config->min) / config->count;
@@ -36,73 +82,929 @@ void stat_binning_calculate_edges(stat_binning_config_t* config, stat_binning_st
             break;
         }
 
+        case BIN_LOG2: {
+            assert(config->min > 0 && "BIN_LOG2 needs a positive minimum");
+            const unsigned bits = private_log2_bits(config->sub_buckets ? config->sub_buckets : 1);
+            const uint64_t base = private_log2_key(config->min, bits);
+            for (stat_size_t i = 0; i <= config->count; i++) {
+                config->edges[i] = private_log2_edge(base + i, bits); // exact, never rounded
+            }
+            config->min = config->edges[0];
+            config->max = config->edges[config->count];
+            break;
+        }
+
+        case BIN_NATURAL:
+            assert(false && "BIN_NATURAL needs the data - use stat_bin_natural_f()");
+            break;
+
         default:
             assert(false && "Invalid binning strategy");
     }
 }
 
 
+// ========================
+// Bin lookup kernel
+// ========================
+
+/** Values per unrolled iteration of the batch loops */
+#define PRIVATE_BIN_BATCH 4
+/** Stack buffer of converted/adjusted keys (kept small for 16-bit stacks) */
+#define PRIVATE_BIN_CHUNK (PRIVATE_BIN_BATCH * 8)
+
+typedef struct {
+    const stat_float_t* edges; // count+1 ascending edges
+    stat_size_t count;         // number of bins
+    stat_float_t lo;           // lowest accepted key (edges[0])
+    stat_float_t hi;           // highest accepted key (edges[count])
+    stat_float_t inv_width;    // 1/bin width when edges are uniform, 0 otherwise
+    uint64_t log2_base;        // BIN_LOG2: key of edges[0]
+    unsigned log2_bits;        // BIN_LOG2: mantissa bits per key
+    bool log2;                 // BIN_LOG2 exponent-bit lookup
+} private_bin_lookup_t;
+
+// The exponent-key path is only safe when the edges really are the BIN_LOG2 grid:
+// a hand-built config may carry a stale or garbage strategy/sub_buckets
+static bool private_lookup_log2_grid(private_bin_lookup_t* lk, const stat_binning_config_t* config) {
+    const stat_size_t sub = config->sub_buckets ? config->sub_buckets : 1;
+    if (config->strategy != BIN_LOG2 || (sub & (sub - 1)) != 0 || sub > (1UL << 20) || !(lk->lo > 0)) {
+        return false;
+    }
+    lk->log2_bits = private_log2_bits(sub);
+    lk->log2_base = private_log2_key(lk->lo, lk->log2_bits);
+    return private_log2_edge(lk->log2_base, lk->log2_bits) == lk->lo &&
+           private_log2_edge(lk->log2_base + lk->count, lk->log2_bits) == lk->hi;
+}
+
+// Uniform edges let the index be computed arithmetically instead of searched
+static void private_lookup_init(private_bin_lookup_t* lk, const stat_binning_config_t* config) {
+    lk->edges = config->edges;
+    lk->count = config->count;
+    lk->lo = config->edges[0];
+    lk->hi = config->edges[config->count];
+    lk->inv_width = 0;
+    lk->log2 = private_lookup_log2_grid(lk, config);
+
+    if (lk->log2) {
+        return;
+    }
+
+    const stat_float_t width = (lk->hi - lk->lo) / config->count;
+    if (!(width > 0)) {
+        return;
+    }
+    for (stat_size_t i = 1; i < config->count; i++) {
+        if (fabs(config->edges[i] - (lk->lo + i * width)) > width * 0.25) {
+            return; // non-uniform (logarithmic, percentile or user supplied)
+        }
+    }
+    lk->inv_width = 1.0 / width;
+}
+
+// O(1) guess, then one comparison either side makes it exact against the (rounded) edges
+static stat_size_t private_lookup_uniform(const private_bin_lookup_t* lk, stat_float_t key) {
+    stat_size_t idx = (stat_size_t)((key - lk->lo) * lk->inv_width);
+    if (idx >= lk->count) idx = lk->count - 1;
+    if (idx > 0 && key < lk->edges[idx]) {
+        idx--;
+    } else if (idx + 1 < lk->count && key >= lk->edges[idx + 1]) {
+        idx++;
+    }
+    return idx;
+}
+
+// Branchless binary search: largest i in [0, count) with edges[i] <= key
+static stat_size_t private_lookup_search(const private_bin_lookup_t* lk, stat_float_t key) {
+    const stat_float_t* base = lk->edges;
+    stat_size_t n = lk->count;
+    while (n > 1) {
+        const stat_size_t half = n >> 1;
+        base = (base[half] <= key) ? base + half : base; // compiles to a conditional move
+        n -= half;
+    }
+    return (stat_size_t)(base - lk->edges);
+}
+
+// Returns false for NaN or out-of-range keys; the last bin is closed on the right
+static bool private_lookup_key(const private_bin_lookup_t* lk, stat_float_t key, stat_size_t* idx) {
+    if (!(key >= lk->lo && key <= lk->hi)) {
+        return false;
+    }
+    if (lk->log2) {
+        const uint64_t k = private_log2_key(key, lk->log2_bits) - lk->log2_base;
+        *idx = (k < lk->count) ? (stat_size_t)k : lk->count - 1; // key == hi lands in the last bin
+    } else {
+        *idx = lk->inv_width ? private_lookup_uniform(lk, key) : private_lookup_search(lk, key);
+    }
+    return true;
+}
+
+static stat_size_t private_bin_keys(const private_bin_lookup_t* lk, const stat_float_t* keys, stat_size_t n, stat_size_t* bins) {
+    stat_size_t rejected = 0;
+    stat_size_t idx;
+    for (stat_size_t i = 0; i < n; i++) {
+        if (private_lookup_key(lk, keys[i], &idx)) {
+            bins[idx]++;
+        } else {
+            rejected++;
+        }
+    }
+    return rejected;
+}
+
+// Arithmetic path unrolled by PRIVATE_BIN_BATCH: independent index computations
+// per iteration keep the pipeline (or a vectorizing compiler) busy
+static stat_size_t private_bin_keys_uniform_batch(const private_bin_lookup_t* lk, const stat_float_t* keys, stat_size_t n, stat_size_t* bins) {
+    stat_size_t i = 0, rejected = 0;
+    for (; i + PRIVATE_BIN_BATCH <= n; i += PRIVATE_BIN_BATCH) {
+        const stat_float_t k0 = keys[i], k1 = keys[i + 1], k2 = keys[i + 2], k3 = keys[i + 3];
+        if ((k0 >= lk->lo && k0 <= lk->hi) & (k1 >= lk->lo && k1 <= lk->hi) &
+            (k2 >= lk->lo && k2 <= lk->hi) & (k3 >= lk->lo && k3 <= lk->hi)) {
+            const stat_size_t b0 = private_lookup_uniform(lk, k0);
+            const stat_size_t b1 = private_lookup_uniform(lk, k1);
+            const stat_size_t b2 = private_lookup_uniform(lk, k2);
+            const stat_size_t b3 = private_lookup_uniform(lk, k3);
+            bins[b0]++; bins[b1]++; bins[b2]++; bins[b3]++;
+        } else {
+            rejected += private_bin_keys(lk, keys + i, PRIVATE_BIN_BATCH, bins);
+        }
+    }
+    return rejected + private_bin_keys(lk, keys + i, n - i, bins);
+}
+
+// Snap values within epsilon of an edge onto it (upper bin), and accept
+// values within epsilon outside the outer edges
+static void private_epsilon_keys(const private_bin_lookup_t* lk, const stat_float_t* values, stat_size_t n, stat_float_t epsilon, stat_float_t* keys) {
+    for (stat_size_t j = 0; j < n; j++) {
+        const stat_float_t key = values[j] + epsilon;
+        keys[j] = (key > lk->hi && key <= lk->hi + 2 * epsilon) ? lk->hi : key;
+    }
+}
+
 void stat_bin_values_i(const stat_int_t* values, stat_size_t count, const stat_binning_config_t* config, stat_size_t* bins) {
     assert(values && "NULL values");
     assert(config && "NULL config");
     assert(config->edges && "NULL edges");
+    assert(config->count > 0 && "Must have at least 1 bin");
+    assert(bins && "NULL bins");
+
+    private_bin_lookup_t lk;
+    private_lookup_init(&lk, config);
+
+    stat_float_t keys[PRIVATE_BIN_CHUNK];
+    stat_size_t rejected = 0;
+    for (stat_size_t i = 0; i < count; i += PRIVATE_BIN_CHUNK) {
+        stat_size_t n = count - i;
+        if (n > PRIVATE_BIN_CHUNK) n = PRIVATE_BIN_CHUNK;
+        stat_cast_int_to_float_array(keys, values + i, n);
+        rejected += lk.inv_width ? private_bin_keys_uniform_batch(&lk, keys, n, bins)
+                                 : private_bin_keys(&lk, keys, n, bins);
+    }
+
+    if (rejected) {
+        errno = ERANGE;
+    }
+}
+
+void stat_bin_values_f(const stat_float_t* values, stat_size_t count, const stat_binning_config_t* config, stat_size_t* bins, stat_float_t epsilon) {
+    assert(values && "NULL values");
+    assert(config && "NULL config");
+    assert(config->edges && "NULL edges");
+    assert(config->count > 0 && "Must have at least 1 bin");
+    assert(bins && "NULL bins");
+    assert(epsilon >= 0 && "Negative epsilon");
+
+    private_bin_lookup_t lk;
+    private_lookup_init(&lk, config);
+
+    stat_size_t rejected = 0;
+    if (epsilon == 0) {
+        rejected = lk.inv_width ? private_bin_keys_uniform_batch(&lk, values, count, bins)
+                                : private_bin_keys(&lk, values, count, bins);
+    } else {
+        stat_float_t keys[PRIVATE_BIN_CHUNK];
+        for (stat_size_t i = 0; i < count; i += PRIVATE_BIN_CHUNK) {
+            stat_size_t n = count - i;
+            if (n > PRIVATE_BIN_CHUNK) n = PRIVATE_BIN_CHUNK;
+            private_epsilon_keys(&lk, values + i, n, epsilon, keys);
+            rejected += lk.inv_width ? private_bin_keys_uniform_batch(&lk, keys, n, bins)
+                                     : private_bin_keys(&lk, keys, n, bins);
+        }
+    }
+
+    if (rejected) {
+        errno = ERANGE;
+    }
+}
+
+// ========================
+// Digitize (per-element bin index)
+// ========================
+
+// One loop per index width keeps the store narrow and the loop free of width checks
+#define PRIVATE_DIGITIZE_LOOP(type, out_of_range)                   \
+    do {                                                            \
+        type* out = (type*)indices + offset;                        \
+        for (stat_size_t i = 0; i < n; i++) {                       \
+            if (private_lookup_key(lk, keys[i], &idx)) {            \
+                out[i] = (type)idx;                                 \
+                if (bins) bins[idx]++;                              \
+            } else {                                                \
+                out[i] = (out_of_range);                            \
+                rejected++;                                         \
+            }                                                       \
+        }                                                           \
+    } while (0)
+
+static stat_size_t private_digitize_keys(const private_bin_lookup_t* lk, const stat_float_t* keys, stat_size_t n,
+                                         void* indices, stat_size_t offset, stat_index_width_t width, stat_size_t* bins) {
+    stat_size_t rejected = 0;
+    stat_size_t idx;
+    switch (width) {
+        case STAT_INDEX_U8:  PRIVATE_DIGITIZE_LOOP(uint8_t, UINT8_MAX); break;
+        case STAT_INDEX_U16: PRIVATE_DIGITIZE_LOOP(uint16_t, UINT16_MAX); break;
+        case STAT_INDEX_U32: PRIVATE_DIGITIZE_LOOP(uint32_t, UINT32_MAX); break;
+        default: assert(false && "Invalid index width");
+    }
+    return rejected;
+}
+
+// The all-ones out-of-range marker must not collide with a real bin index
+static void private_assert_index_width(const stat_binning_config_t* config, stat_index_width_t width) {
+    (void)config;
+    assert((width != STAT_INDEX_U8 || config->count < UINT8_MAX) && "Too many bins for 8-bit indices");
+    assert((width != STAT_INDEX_U16 || config->count < UINT16_MAX) && "Too many bins for 16-bit indices");
+    assert((width != STAT_INDEX_U32 || config->count < UINT32_MAX) && "Too many bins for 32-bit indices");
+}
+
+void* stat_digitize_f(const stat_float_t* values, stat_size_t count, const stat_binning_config_t* config,
+                      void* indices, stat_index_width_t width, stat_size_t* bins, stat_float_t epsilon) {
+    assert(values && "NULL values");
+    assert(config && "NULL config");
+    assert(config->edges && "NULL edges");
+    assert(config->count > 0 && "Must have at least 1 bin");
+    assert(indices && "NULL indices");
+    assert(epsilon >= 0 && "Negative epsilon");
+    private_assert_index_width(config, width);
+
+    private_bin_lookup_t lk;
+    private_lookup_init(&lk, config);
+
+    stat_size_t rejected = 0;
+    if (epsilon == 0) {
+        rejected = private_digitize_keys(&lk, values, count, indices, 0, width, bins);
+    } else {
+        stat_float_t keys[PRIVATE_BIN_CHUNK];
+        for (stat_size_t i = 0; i < count; i += PRIVATE_BIN_CHUNK) {
+            stat_size_t n = count - i;
+            if (n > PRIVATE_BIN_CHUNK) n = PRIVATE_BIN_CHUNK;
+            private_epsilon_keys(&lk, values + i, n, epsilon, keys);
+            rejected += private_digitize_keys(&lk, keys, n, indices, i, width, bins);
+        }
+    }
+
+    if (rejected) {
+        errno = ERANGE;
+    }
+    return indices;
+}
+
+void* stat_digitize_i(const stat_int_t* values, stat_size_t count, const stat_binning_config_t* config,
+                      void* indices, stat_index_width_t width, stat_size_t* bins) {
+    assert(values && "NULL values");
+    assert(config && "NULL config");
+    assert(config->edges && "NULL edges");
+    assert(config->count > 0 && "Must have at least 1 bin");
+    assert(indices && "NULL indices");
+    private_assert_index_width(config, width);
+
+    private_bin_lookup_t lk;
+    private_lookup_init(&lk, config);
+
+    stat_float_t keys[PRIVATE_BIN_CHUNK];
+    stat_size_t rejected = 0;
+    for (stat_size_t i = 0; i < count; i += PRIVATE_BIN_CHUNK) {
+        stat_size_t n = count - i;
+        if (n > PRIVATE_BIN_CHUNK) n = PRIVATE_BIN_CHUNK;
+        stat_cast_int_to_float_array(keys, values + i, n);
+        rejected += private_digitize_keys(&lk, keys, n, indices, i, width, bins);
+    }
+
+    if (rejected) {
+        errno = ERANGE;
+    }
+    return indices;
+}
+
+// ========================
+// Parallel (sharded) binning
+// ========================
+
+// Private row length in elements, rounded up to whole cache lines
+static stat_size_t private_padded_row(stat_size_t bin_count) {
+    const stat_size_t per_line = STAT_CACHE_LINE / sizeof(stat_size_t);
+    return (bin_count + per_line - 1) / per_line * per_line;
+}
+
+stat_size_t stat_bin_workspace_size(const stat_binning_config_t* config, stat_size_t threads) {
+    assert(config && "NULL config");
+    assert(threads > 0 && "Must have at least 1 thread");
+    return private_padded_row(config->count) * threads;
+}
+
+// Pairwise tree merge of the private rows into the caller's bins
+static void private_merge_rows(stat_size_t* workspace, stat_size_t row, stat_size_t threads, stat_size_t bin_count, stat_size_t* bins) {
+    for (stat_size_t stride = 1; stride < threads; stride <<= 1) {
+        const long pairs = (long)(threads - stride);
+        const long step = (long)(stride << 1);
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule(static)
+        #endif
+        for (long t = 0; t < pairs; t += step) {
+            stat_size_t* dst = workspace + (stat_size_t)t * row;
+            const stat_size_t* src = dst + stride * row;
+            for (stat_size_t b = 0; b < bin_count; b++) {
+                dst[b] += src[b];
+            }
+        }
+    }
+    for (stat_size_t b = 0; b < bin_count; b++) {
+        bins[b] += workspace[b];
+    }
+}
+
+// Flags ERANGE in the calling thread: errno set inside workers is thread-local
+static void private_check_total(const stat_size_t* workspace, stat_size_t bin_count, stat_size_t count) {
+    stat_size_t binned = 0;
+    for (stat_size_t b = 0; b < bin_count; b++) {
+        binned += workspace[b];
+    }
+    if (binned != count) {
+        errno = ERANGE;
+    }
+}
+
+void stat_bin_values_parallel_f(const stat_float_t* values, stat_size_t count, const stat_binning_config_t* config,
+                                stat_size_t* bins, stat_float_t epsilon, stat_size_t threads, stat_size_t* workspace) {
+    assert(values && "NULL values");
+    assert(config && "NULL config");
     assert(bins && "NULL bins");
+    assert(workspace && "NULL workspace");
+    assert(threads > 0 && "Must have at least 1 thread");
+
+    const stat_size_t row = private_padded_row(config->count);
+    const stat_size_t chunk = (count + threads - 1) / threads;
+    memset(workspace, 0, stat_bin_workspace_size(config, threads) * sizeof(stat_size_t));
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) num_threads(threads)
+    #endif
+    for (long t = 0; t < (long)threads; t++) {
+        const stat_size_t start = (stat_size_t)t * chunk;
+        if (start < count) {
+            const stat_size_t n = (count - start < chunk) ? count - start : chunk;
+            stat_bin_values_f(values + start, n, config, workspace + (stat_size_t)t * row, epsilon);
+        }
+    }
+
+    private_merge_rows(workspace, row, threads, config->count, bins);
+    private_check_total(workspace, config->count, count);
+}
+
+void stat_bin_values_parallel_i(const stat_int_t* values, stat_size_t count, const stat_binning_config_t* config,
+                                stat_size_t* bins, stat_size_t threads, stat_size_t* workspace) {
+    assert(values && "NULL values");
+    assert(config && "NULL config");
+    assert(bins && "NULL bins");
+    assert(workspace && "NULL workspace");
+    assert(threads > 0 && "Must have at least 1 thread");
+
+    const stat_size_t row = private_padded_row(config->count);
+    const stat_size_t chunk = (count + threads - 1) / threads;
+    memset(workspace, 0, stat_bin_workspace_size(config, threads) * sizeof(stat_size_t));
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) num_threads(threads)
+    #endif
+    for (long t = 0; t < (long)threads; t++) {
+        const stat_size_t start = (stat_size_t)t * chunk;
+        if (start < count) {
+            const stat_size_t n = (count - start < chunk) ? count - start : chunk;
+            stat_bin_values_i(values + start, n, config, workspace + (stat_size_t)t * row);
+        }
+    }
+
+    private_merge_rows(workspace, row, threads, config->count, bins);
+    private_check_total(workspace, config->count, count);
+}
+
+// ========================
+// 2D histograms
+// ========================
+
+// Joint lookup of (x, y) pairs into the row-major matrix counts[y * x_count + x]
+static stat_size_t private_bin_pairs_2d(const private_bin_lookup_t* lx, const private_bin_lookup_t* ly,
+                                        const stat_float_t* xs, const stat_float_t* ys, stat_size_t count,
+                                        stat_float_t epsilon, stat_size_t* counts) {
+    stat_float_t kx[PRIVATE_BIN_CHUNK], ky[PRIVATE_BIN_CHUNK];
+    stat_size_t rejected = 0;
+    stat_size_t ix, iy;
 
-    const stat_float_t range = config->max - config->min;
+    for (stat_size_t i = 0; i < count; i += PRIVATE_BIN_CHUNK) {
+        stat_size_t n = count - i;
+        if (n > PRIVATE_BIN_CHUNK) n = PRIVATE_BIN_CHUNK;
+
+        const stat_float_t* px = xs + i;
+        const stat_float_t* py = ys + i;
+        if (epsilon != 0) {
+            private_epsilon_keys(lx, px, n, epsilon, kx);
+            private_epsilon_keys(ly, py, n, epsilon, ky);
+            px = kx;
+            py = ky;
+        }
+
+        for (stat_size_t j = 0; j < n; j++) {
+            if (private_lookup_key(lx, px[j], &ix) && private_lookup_key(ly, py[j], &iy)) {
+                counts[iy * lx->count + ix]++;
+            } else {
+                rejected++;
+            }
+        }
+    }
+    return rejected;
+}
+
+stat_size_t* stat_bin_values_2d_f(const stat_float_t* xs, const stat_float_t* ys, stat_size_t count,
+                                  const stat_binning_config_t* x_axis, const stat_binning_config_t* y_axis,
+                                  stat_size_t* counts, stat_float_t epsilon) {
+    assert(xs && ys && "NULL values");
+    assert(x_axis && x_axis->edges && x_axis->count > 0 && "Invalid x axis");
+    assert(y_axis && y_axis->edges && y_axis->count > 0 && "Invalid y axis");
+    assert(counts && "NULL counts");
+    assert(epsilon >= 0 && "Negative epsilon");
+
+    private_bin_lookup_t lx, ly;
+    private_lookup_init(&lx, x_axis);
+    private_lookup_init(&ly, y_axis);
+
+    if (private_bin_pairs_2d(&lx, &ly, xs, ys, count, epsilon, counts)) {
+        errno = ERANGE;
+    }
+    return counts;
+}
+
+stat_size_t stat_bin2d_workspace_size(const stat_binning_config_t* x_axis, const stat_binning_config_t* y_axis, stat_size_t threads) {
+    assert(x_axis && y_axis && "NULL axis");
+    assert(threads > 0 && "Must have at least 1 thread");
+    return private_padded_row(x_axis->count * y_axis->count) * threads;
+}
+
+stat_size_t* stat_bin_values_2d_parallel_f(const stat_float_t* xs, const stat_float_t* ys, stat_size_t count,
+                                           const stat_binning_config_t* x_axis, const stat_binning_config_t* y_axis,
+                                           stat_size_t* counts, stat_float_t epsilon,
+                                           stat_size_t threads, stat_size_t* workspace) {
+    assert(xs && ys && "NULL values");
+    assert(x_axis && x_axis->edges && x_axis->count > 0 && "Invalid x axis");
+    assert(y_axis && y_axis->edges && y_axis->count > 0 && "Invalid y axis");
+    assert(counts && "NULL counts");
+    assert(workspace && "NULL workspace");
+    assert(threads > 0 && "Must have at least 1 thread");
+
+    const stat_size_t cells = x_axis->count * y_axis->count;
+    const stat_size_t tile = private_padded_row(cells);
+    const stat_size_t chunk = (count + threads - 1) / threads;
+    memset(workspace, 0, stat_bin2d_workspace_size(x_axis, y_axis, threads) * sizeof(stat_size_t));
+
+    private_bin_lookup_t lx, ly;
+    private_lookup_init(&lx, x_axis);
+    private_lookup_init(&ly, y_axis);
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) num_threads(threads)
+    #endif
+    for (long t = 0; t < (long)threads; t++) {
+        const stat_size_t start = (stat_size_t)t * chunk;
+        if (start < count) {
+            const stat_size_t n = (count - start < chunk) ? count - start : chunk;
+            private_bin_pairs_2d(&lx, &ly, xs + start, ys + start, n, epsilon, workspace + (stat_size_t)t * tile);
+        }
+    }
+
+    private_merge_rows(workspace, tile, threads, cells, counts);
+    private_check_total(workspace, cells, count);
+    return counts;
+}
+
+stat_size_t* stat_bin2d_marginal_x(const stat_size_t* counts, const stat_binning_config_t* x_axis,
+                                   const stat_binning_config_t* y_axis, stat_size_t* x_bins) {
+    assert(counts && x_bins && "NULL array");
+    assert(x_axis && y_axis && "NULL axis");
+
+    for (stat_size_t x = 0; x < x_axis->count; x++) {
+        x_bins[x] = 0;
+    }
+    for (stat_size_t y = 0; y < y_axis->count; y++) {
+        const stat_size_t* row = counts + y * x_axis->count;
+        for (stat_size_t x = 0; x < x_axis->count; x++) {
+            x_bins[x] += row[x];
+        }
+    }
+    return x_bins;
+}
+
+stat_size_t* stat_bin2d_marginal_y(const stat_size_t* counts, const stat_binning_config_t* x_axis,
+                                   const stat_binning_config_t* y_axis, stat_size_t* y_bins) {
+    assert(counts && y_bins && "NULL array");
+    assert(x_axis && y_axis && "NULL axis");
+
+    for (stat_size_t y = 0; y < y_axis->count; y++) {
+        const stat_size_t* row = counts + y * x_axis->count;
+        stat_size_t sum = 0;
+        for (stat_size_t x = 0; x < x_axis->count; x++) {
+            sum += row[x];
+        }
+        y_bins[y] = sum;
+    }
+    return y_bins;
+}
+
+// ========================
+// Equal-frequency edges
+// ========================
+
+/*
+ * Fills edges[first..last] (interior cuts) from ws[lo, hi), a block that holds
+ * exactly the sorted ranks lo..hi-1. The middle cut selects its two ranks, then
+ * the cuts left of it recurse on [lo, lower+2) and those right of it on [lower, hi)
+ * - both are still complete blocks, so selections never cross.
+ */
+static void private_select_cuts(stat_float_t* ws, stat_size_t n, stat_size_t lo, stat_size_t hi,
+                                stat_binning_config_t* config, stat_size_t first, stat_size_t last)
+{
+    while (first <= last) {
+        const stat_size_t mid = first + (last - first) / 2;
+        const stat_float_t percentile = 100.0 * mid / config->count; // as stat_auto_bin_f always cut
+        const stat_float_t rank = (percentile / 100.0f) * (n - 1);
+        const stat_size_t lower = (stat_size_t)rank;
+        const stat_float_t frac = rank - lower;
+
+        const stat_float_t value = stat_select_f(ws + lo, hi - lo, lower - lo);
+        if (frac > 0.0 && lower + 1 < hi) {
+            const stat_float_t next = stat_select_f(ws + lower + 1, hi - lower - 1, 0);
+            config->edges[mid] = value + frac * (next - value);
+        } else {
+            config->edges[mid] = value;
+        }
+
+        if (mid > first) {
+            private_select_cuts(ws, n, lo, (lower + 2 < hi) ? lower + 2 : hi, config, first, mid - 1);
+        }
+        // Right half iteratively: recursion depth stays log2(bins)
+        lo = lower;
+        first = mid + 1;
+    }
+}
+
+stat_binning_config_t* stat_bin_equal_frequency_f(const stat_float_t* values, stat_size_t count,
+                                                  stat_binning_config_t* config, stat_float_t* workspace)
+{
+    assert(values && "NULL values");
+    assert(config && "NULL config");
+    assert(config->edges && "NULL edges");
+    assert(config->count > 0 && "Must have at least 1 bin");
+    assert(workspace && "NULL workspace");
+
+    if (count == 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    // Copy and range in one pass
+    stat_float_t min = values[0], max = values[0];
     for (stat_size_t i = 0; i < count; i++) {
-        stat_float_t normalized = (values[i] - config->min) / range;
-        stat_size_t bin = (stat_size_t)(normalized * config->count);
-        if (bin >= config->count) bin = config->count - 1;
-        bins[bin]++;
+        const stat_float_t x = values[i];
+        if (isnan(x)) {
+            errno = EDOM;
+            return NULL;
+        }
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+        workspace[i] = x;
+    }
+
+    config->strategy = BIN_PERCENTILE;
+    config->min = config->edges[0] = min;
+    config->max = config->edges[config->count] = max;
+    if (config->count > 1) {
+        private_select_cuts(workspace, count, 0, count, config, 1, config->count - 1);
     }
+    return config;
 }
 
-void stat_auto_bin_f(const stat_float_t* values, stat_size_t count,
-                    stat_binning_config_t* config, stat_binning_strategy_t strategy)
+// ========================
+// Natural breaks
+// ========================
+
+typedef struct {
+    const stat_float_t* s1; // prefix sums of (sorted - shift)
+    const stat_float_t* s2; // prefix sums of (sorted - shift)^2
+    const stat_float_t* prev; // best cost of m bins ending at each index
+    stat_float_t* cur;        // best cost of m+1 bins ending at each index
+    stat_size_t* split;       // start index of the last bin for each end index
+} private_jenks_t;
+
+// Sum of squared deviations of sorted[i..j]
+static stat_float_t private_jenks_cost(const private_jenks_t* jk, stat_size_t i, stat_size_t j) {
+    const stat_float_t sum = jk->s1[j + 1] - jk->s1[i];
+    const stat_float_t ssq = jk->s2[j + 1] - jk->s2[i];
+    const stat_float_t cost = ssq - sum * sum / (j - i + 1);
+    return cost > 0.0 ? cost : 0.0;
+}
+
+// Fills cur[lo..hi]; the best split for every end index in range lies in [opt_lo, opt_hi]
+static void private_jenks_row(private_jenks_t* jk, stat_size_t lo, stat_size_t hi,
+                              stat_size_t opt_lo, stat_size_t opt_hi)
+{
+    while (lo <= hi) {
+        const stat_size_t mid = lo + (hi - lo) / 2;
+        const stat_size_t last = opt_hi < mid ? opt_hi : mid;
+        stat_size_t best = opt_lo;
+        stat_float_t best_cost = INFINITY;
+
+        for (stat_size_t i = opt_lo; i <= last; i++) {
+            const stat_float_t c = jk->prev[i - 1] + private_jenks_cost(jk, i, mid);
+            if (c < best_cost) {
+                best_cost = c;
+                best = i;
+            }
+        }
+        jk->cur[mid] = best_cost;
+        jk->split[mid] = best;
+
+        if (mid > lo) {
+            private_jenks_row(jk, lo, mid - 1, opt_lo, best);
+        }
+        lo = mid + 1;
+        opt_lo = best;
+    }
+}
+
+stat_size_t stat_bin_natural_workspace_size(stat_size_t count) {
+    return 5 * count + 2;
+}
+
+stat_size_t stat_bin_natural_splits_size(stat_size_t count, stat_size_t bins) {
+    return count * bins;
+}
+
+stat_binning_config_t* stat_bin_natural_f(const stat_float_t* values, stat_size_t count,
+                                          stat_binning_config_t* config,
+                                          stat_float_t* workspace, stat_size_t* splits)
 {
-    // Input validation
     assert(values && "NULL values");
-    assert(count > 0 && "Empty dataset");
     assert(config && "NULL config");
     assert(config->edges && "NULL edges");
     assert(config->count > 0 && "Must have at least 1 bin");
+    assert(workspace && "NULL workspace");
+    assert(splits && "NULL splits");
 
-    // Get data range
-    config->min = stat_min_float_array(values, count);
-    config->max = stat_max_float_array(values, count);
+    const stat_size_t bins = config->count;
+    if (count < bins || count == 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+    if (!stat_array_is_finite_f(values, count)) {
+        errno = EDOM;
+        return NULL;
+    }
 
-    if (strategy == BIN_PERCENTILE) {
-        config->edges[0] = config->min;
-        config->edges[config->count] = config->max;
+    stat_float_t* sorted = workspace;
+    stat_float_t* s1 = sorted + count;
+    stat_float_t* s2 = s1 + count + 1;
+    stat_float_t* rows[2];
+    rows[0] = s2 + count + 1;
+    rows[1] = rows[0] + count;
 
-        // Allocate memory for percentiles and cuts
-        stat_size_t num_cuts = config->count - 1;
-        stat_float_t* cuts = malloc(num_cuts * sizeof(stat_float_t));
-        stat_float_t* percentiles = malloc(num_cuts * sizeof(stat_float_t));
+    memcpy(sorted, values, count * sizeof(stat_float_t));
+    stat_sort_f(sorted, count);
 
-        if (!cuts || !percentiles) {
-            free(cuts);
-            free(percentiles);
-            errno = ENOMEM;
+    // Shifting by the median keeps the prefix sums small (less cancellation)
+    const stat_float_t shift = sorted[count / 2];
+    s1[0] = s2[0] = 0.0;
+    for (stat_size_t i = 0; i < count; i++) {
+        const stat_float_t x = sorted[i] - shift;
+        s1[i + 1] = s1[i] + x;
+        s2[i + 1] = s2[i] + x * x;
+    }
+
+    private_jenks_t jk;
+    jk.s1 = s1;
+    jk.s2 = s2;
+
+    // One bin: everything up to j
+    for (stat_size_t j = 0; j < count; j++) {
+        rows[0][j] = private_jenks_cost(&jk, 0, j);
+        splits[j] = 0;
+    }
+
+    // Bin m (0-based) ends at j >= m and starts at i in [m, j]
+    for (stat_size_t m = 1; m < bins; m++) {
+        jk.prev = rows[(m - 1) & 1];
+        jk.cur = rows[m & 1];
+        jk.split = splits + (size_t)m * count;
+        private_jenks_row(&jk, m, count - 1, m, count - 1);
+    }
+
+    // Walk the split table back from the last value
+    config->strategy = BIN_NATURAL;
+    config->min = config->edges[0] = sorted[0];
+    config->max = config->edges[bins] = sorted[count - 1];
+    stat_size_t end = count - 1;
+    for (stat_size_t m = bins - 1; m > 0; m--) {
+        const stat_size_t start = splits[(size_t)m * count + end];
+        config->edges[m] = sorted[start];
+        end = start - 1;
+    }
+    return config;
+}
+
+// ========================
+// Automatic bin count
+// ========================
+
+typedef struct {
+    stat_float_t min;
+    stat_float_t max;
+    stat_float_t mean;
+    stat_float_t m2;   // sum of squared deviations
+    stat_float_t m3;   // sum of cubed deviations
+    bool has_nan;
+} private_moments_t;
+
+// One fused pass: range, and optionally the central moments (online update)
+static void private_scan_f(const stat_float_t* values, stat_size_t count, private_moments_t* m, bool moments) {
+    m->min = m->max = values[0];
+    m->mean = m->m2 = m->m3 = 0.0;
+    m->has_nan = false;
+
+    for (stat_size_t i = 0; i < count; i++) {
+        const stat_float_t x = values[i];
+        if (isnan(x)) {
+            m->has_nan = true;
             return;
         }
+        m->min = x < m->min ? x : m->min;
+        m->max = x > m->max ? x : m->max;
+
+        if (moments) {
+            const stat_float_t n = (stat_float_t)(i + 1);
+            const stat_float_t delta = x - m->mean;
+            const stat_float_t delta_n = delta / n;
+            const stat_float_t term = delta * delta_n * (n - 1);
+            m->mean += delta_n;
+            m->m3 += term * delta_n * (n - 2) - 3.0 * delta_n * m->m2;
+            m->m2 += term;
+        }
+    }
+}
+
+static stat_size_t private_bins_for_width(stat_float_t range, stat_float_t width) {
+    if (!(width > 0.0) || !(range > 0.0)) {
+        return 1;
+    }
+    const stat_float_t bins = ceil(range / width);
+    return bins >= (stat_float_t)STAT_SIZE_MAX ? STAT_SIZE_MAX : (stat_size_t)bins;
+}
+
+// Bin count for a rule; m receives the fused-pass range for the caller
+static stat_size_t private_rule_bins(const stat_float_t* values, stat_size_t count, stat_bin_rule_t rule,
+                                     stat_float_t* workspace, private_moments_t* m)
+{
+    assert(values && "NULL values");
+
+    if (count == 0) {
+        errno = EINVAL;
+        return 0;
+    }
+
+    private_scan_f(values, count, m, rule == BIN_RULE_SCOTT || rule == BIN_RULE_DOANE);
+    if (m->has_nan) {
+        errno = EDOM;
+        return 0;
+    }
+
+    const stat_float_t n = (stat_float_t)count;
+    const stat_float_t range = m->max - m->min;
+    const stat_float_t sturges = ceil(log2(n)) + 1.0;
 
-        // Calculate percentile cuts (25th, 50th, 75th for quartiles etc.)
-        for (stat_size_t i = 0; i < num_cuts; i++) {
-            cuts[i] = 100.0 * (i + 1) / config->count;
+    if (!(range > 0.0)) {
+        return 1;
+    }
+
+    switch (rule) {
+        case BIN_RULE_STURGES:
+            return (stat_size_t)sturges;
+
+        case BIN_RULE_SCOTT: {
+            const stat_float_t sigma = sqrt(m->m2 / n);
+            return private_bins_for_width(range, 3.49 * sigma / cbrt(n));
         }
 
-        // Compute percentiles
-        stat_percentiles_array_f(values, count, cuts, percentiles, num_cuts);
+        case BIN_RULE_FREEDMAN_DIACONIS: {
+            assert(workspace && "Freedman-Diaconis needs a workspace of count elements");
+            memcpy(workspace, values, count * sizeof(stat_float_t));
+            // Both selections share one scratch copy (each one scans the full range)
+            const stat_float_t q1 = stat_percentile_select_f(workspace, count, 25.0);
+            const stat_float_t q3 = stat_percentile_select_f(workspace, count, 75.0);
+            return private_bins_for_width(range, 2.0 * (q3 - q1) / cbrt(n));
+        }
 
-        // Fill bin edges
-        for (stat_size_t i = 0; i < num_cuts; i++) {
-            config->edges[i + 1] = percentiles[i];
+        case BIN_RULE_DOANE: {
+            if (count < 3 || !(m->m2 > 0.0)) {
+                return (stat_size_t)sturges;
+            }
+            const stat_float_t g1 = sqrt(n) * m->m3 / pow(m->m2, 1.5);
+            const stat_float_t sigma_g1 = sqrt(6.0 * (n - 2) / ((n + 1) * (n + 3)));
+            return (stat_size_t)ceil(1.0 + log2(n) + log2(1.0 + fabs(g1) / sigma_g1));
         }
 
-        free(cuts);
-        free(percentiles);
+        default:
+            assert(false && "Invalid bin rule");
+            return 0;
+    }
+}
+
+stat_size_t stat_bin_count_f(const stat_float_t* values, stat_size_t count, stat_bin_rule_t rule, stat_float_t* workspace) {
+    private_moments_t m;
+    return private_rule_bins(values, count, rule, workspace, &m);
+}
+
+stat_binning_config_t* stat_auto_bin_rule_f(const stat_float_t* values, stat_size_t count,
+                                            stat_binning_config_t* config, stat_bin_rule_t rule,
+                                            stat_float_t* workspace, stat_size_t workspace_size)
+{
+    assert(config && "NULL config");
+    assert(workspace && "NULL workspace");
+    assert(workspace_size >= 2 && "Workspace must hold at least 2 edges");
+    assert((rule != BIN_RULE_FREEDMAN_DIACONIS || workspace_size >= count) && "Workspace smaller than count");
+
+    private_moments_t range;
+    stat_size_t bins = private_rule_bins(values, count, rule, workspace, &range);
+    if (bins == 0) {
+        return NULL;
+    }
+    if (bins > workspace_size - 1) {
+        bins = workspace_size - 1;
+        errno = ERANGE;
+    }
+
+    config->min = range.min;
+    config->max = range.max;
+    if (!(config->max > config->min)) {
+        config->min -= 0.5;
+        config->max += 0.5;
+    }
+    config->count = bins;
+    config->edges = workspace;
+    stat_binning_calculate_edges(config, BIN_LINEAR);
+    return config;
+}
+
+void stat_auto_bin_f(const stat_float_t* values, stat_size_t count,
+                    stat_binning_config_t* config, stat_binning_strategy_t strategy)
+{
+    // Input validation
+    assert(values && "NULL values");
+    assert(count > 0 && "Empty dataset");
+    assert(config && "NULL config");
+    assert(config->edges && "NULL edges");
+    assert(config->count > 0 && "Must have at least 1 bin");
+
+    if (strategy == BIN_PERCENTILE) {
+        stat_float_t* workspace = malloc(count * sizeof(stat_float_t));
+        if (!workspace) {
+            errno = ENOMEM;
+            return;
+        }
+        stat_bin_equal_frequency_f(values, count, config, workspace);
+        free(workspace);
+    } else if (strategy == BIN_NATURAL) {
+        stat_float_t* workspace = malloc(stat_bin_natural_workspace_size(count) * sizeof(stat_float_t));
+        stat_size_t* splits = malloc((size_t)stat_bin_natural_splits_size(count, config->count) * sizeof(stat_size_t));
+        if (!workspace || !splits) {
+            errno = ENOMEM;
+        } else {
+            stat_bin_natural_f(values, count, config, workspace, splits);
+        }
+        free(workspace);
+        free(splits);
     } else {
+        // Get data range in one pass
+        private_moments_t range;
+        private_scan_f(values, count, &range, false);
+        config->min = range.min;
+        config->max = range.max;
         stat_binning_calculate_edges(config, strategy);
     }
 }
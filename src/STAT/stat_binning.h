@@ -14,7 +14,9 @@
 typedef enum {
     BIN_LINEAR,      ///< Equal-width bins
     BIN_LOGARITHMIC, ///< Logarithmically spaced bins
-    BIN_PERCENTILE   ///< Bins with equal data counts
+    BIN_PERCENTILE,  ///< Bins with equal data counts
+    BIN_LOG2,        ///< Octaves split into sub_buckets, indexed from IEEE-754 exponent/mantissa bits
+    BIN_NATURAL      ///< Jenks natural breaks: minimum within-bin squared deviation (needs the data)
 } stat_binning_strategy_t;
 
 /**
@@ -26,6 +28,8 @@ typedef struct {
     stat_float_t max;    ///< Maximum bin edge
     stat_size_t count;   ///< Number of bins
     stat_float_t* edges; ///< Caller-allocated array of bin edges
+    stat_binning_strategy_t strategy; ///< Strategy the edges were computed with (set by stat_binning_calculate_edges)
+    stat_size_t sub_buckets;          ///< BIN_LOG2 only: bins per octave, a power of two (0 = 1)
 } stat_binning_config_t;
 
 /**
@@ -54,13 +58,45 @@ void stat_binning_calculate_edges(
     stat_binning_strategy_t strategy
 );
 
+/**
+ * @brief Number of BIN_LOG2 bins needed to cover [min, max]
+ * @param min Smallest value to bin (must be > 0)
+ * @param max Largest value to bin (must be >= min)
+ * @param sub_buckets Bins per octave, a power of two (0 = 1)
+ * @return Bin count to store in config->count before stat_binning_calculate_edges()
+ * @details BIN_LOG2 edges lie on the grid 2^e * (1 + j/sub_buckets), so every value's
+ *          bin is read straight from its exponent and top mantissa bits - O(1) with no
+ *          log()/pow() calls. stat_binning_calculate_edges() snaps config->min down to
+ *          the grid and sets config->max to the last edge.
+ *
+ * @code
+ * stat_binning_config_t cfg = {0};
+ * cfg.min = 0.001;
+ * cfg.max = 1000.0;
+ * cfg.sub_buckets = 4; // quarter-octave resolution
+ * cfg.count = stat_binning_log2_count(cfg.min, cfg.max, cfg.sub_buckets);
+ * cfg.edges = malloc((cfg.count+1) * sizeof(stat_float_t));
+ * stat_binning_calculate_edges(&cfg, BIN_LOG2);
+ * @endcode
+ */
+stat_size_t stat_binning_log2_count(
+    stat_float_t min,
+    stat_float_t max,
+    stat_size_t sub_buckets
+);
+
 /**
  * @brief Bins integer values into pre-allocated bins
  * @param values Input values to bin
  * @param count Number of values
- * @param config Binning configuration
- * @param[out] bins Caller-allocated array (size=config->count)
- * 
+ * @param config Binning configuration (edges must be ascending)
+ * @param[out] bins Caller-allocated array (size=config->count), counts are added
+ * @throws ERANGE if any value fell outside [edges[0], edges[count]] (it is skipped)
+ * @details Bin i is [edges[i], edges[i+1]), the last bin is closed on the right.
+ *          Uniform edges use an O(1) arithmetic lookup (4-way unrolled batches),
+ *          any other edges (logarithmic, percentile, user supplied) a branchless
+ *          binary search - O(log count) per value with no unpredictable branches.
+ *
  * @code
  * stat_int_t data[1000] = {...};
  * stat_binning_config_t cfg = {...};
@@ -78,7 +114,15 @@ void stat_bin_values_i(
 
 /**
  * @brief Bins float values with epsilon comparison
- * @param epsilon Tolerance for edge comparisons
+ * @param values Input values to bin
+ * @param count Number of values
+ * @param config Binning configuration (edges must be ascending)
+ * @param[out] bins Caller-allocated array (size=config->count), counts are added
+ * @param epsilon Tolerance for edge comparisons: a value less than epsilon below an
+ *                edge counts in the bin above it, and values within epsilon outside
+ *                the outer edges are kept. Must be smaller than the narrowest bin.
+ * @throws ERANGE if any value (or NaN) fell outside the edges (it is skipped)
+ * @details Same lookup kernel as stat_bin_values_i().
  * 
  * @code
  * stat_float_t measurements[500] = {...};
@@ -96,6 +140,64 @@ void stat_bin_values_f(
     stat_float_t epsilon
 );
 
+/**
+ * @brief Element type of a digitize index array
+ * @details Narrow indices cut the bandwidth of the output stream - 256 bins or
+ *          fewer fit STAT_INDEX_U8. The all-ones value of each width marks a
+ *          value that fell outside the edges.
+ */
+typedef enum {
+    STAT_INDEX_U8,   ///< uint8_t indices, count < 255, out of range = UINT8_MAX
+    STAT_INDEX_U16,  ///< uint16_t indices, count < 65535, out of range = UINT16_MAX
+    STAT_INDEX_U32   ///< uint32_t indices, out of range = UINT32_MAX
+} stat_index_width_t;
+
+/**
+ * @brief Writes the bin index of every value (numpy digitize) and optionally counts them
+ * @param values Input values
+ * @param count Number of values
+ * @param config Binning configuration (edges must be ascending)
+ * @param[out] indices Caller-allocated array of count elements of the chosen width
+ * @param width Index element type
+ * @param[out] bins Optional caller-allocated counts (size=config->count, counts are
+ *                  added) filled in the same pass; NULL to skip
+ * @param epsilon Edge tolerance, as for stat_bin_values_f()
+ * @return indices pointer for chaining
+ * @throws ERANGE if any value fell outside the edges (its index is the all-ones marker)
+ * @details Shares the lookup kernel with stat_bin_values_f(), so indices always
+ *          agree with the counts it produces.
+ *
+ * @code
+ * uint8_t idx[1000];
+ * stat_size_t bins[16] = {0};
+ * stat_digitize_f(samples, 1000, &cfg, idx, STAT_INDEX_U8, bins, 0);
+ * // grouped stats: idx[i] is the bin of samples[i]
+ * @endcode
+ */
+void* stat_digitize_f(
+    const stat_float_t* values,
+    stat_size_t count,
+    const stat_binning_config_t* config,
+    void* indices,
+    stat_index_width_t width,
+    stat_size_t* bins,
+    stat_float_t epsilon
+);
+
+/**
+ * @brief Integer version of stat_digitize_f() (exact edge comparison)
+ * @return indices pointer for chaining
+ * @throws ERANGE if any value fell outside the edges
+ */
+void* stat_digitize_i(
+    const stat_int_t* values,
+    stat_size_t count,
+    const stat_binning_config_t* config,
+    void* indices,
+    stat_index_width_t width,
+    stat_size_t* bins
+);
+
 /**
  * @brief Computes automatic bin edges from data
  * @param[out] config Initialized config with allocated edges array
@@ -119,6 +221,280 @@ void stat_auto_bin_f(
     stat_binning_strategy_t strategy
 );
 
+/**
+ * @brief Equal-frequency (BIN_PERCENTILE) edges by multi-quantile selection
+ * @param values Input data
+ * @param count Number of values
+ * @param[in,out] config count and edges (count+1 elements) set by the caller;
+ *                min, max, edges and strategy are filled in
+ * @param workspace Caller scratch of count elements (receives a reordered copy)
+ * @return config pointer for chaining, NULL on error
+ * @throws EINVAL if count=0, EDOM if values contain NaN
+ * @note Edges equal stat_percentiles_array_f() at 100*i/config->count, but the
+ *       cuts are found by nested quickselect on one scratch copy - O(n log bins)
+ *       instead of a full sort, and no allocation.
+ */
+stat_binning_config_t* stat_bin_equal_frequency_f(
+    const stat_float_t* values,
+    stat_size_t count,
+    stat_binning_config_t* config,
+    stat_float_t* workspace
+);
+
+/**
+ * @brief Workspace for stat_bin_natural_f()
+ * @param count Number of values
+ * @return Number of stat_float_t elements (sorted copy, prefix sums, two DP rows)
+ */
+stat_size_t stat_bin_natural_workspace_size(stat_size_t count);
+
+/**
+ * @brief Split table for stat_bin_natural_f()
+ * @param count Number of values
+ * @param bins Number of bins
+ * @return Number of stat_size_t elements (one row of split points per bin)
+ */
+stat_size_t stat_bin_natural_splits_size(stat_size_t count, stat_size_t bins);
+
+/**
+ * @brief Jenks/Fisher natural breaks (BIN_NATURAL) - optimal 1D k-partition edges
+ * @param values Input data
+ * @param count Number of values (>= config->count)
+ * @param[in,out] config count and edges (count+1 elements) set by the caller;
+ *                min, max, edges and strategy are filled in
+ * @param workspace Caller scratch, stat_bin_natural_workspace_size() elements
+ * @param splits Caller scratch, stat_bin_natural_splits_size() elements
+ * @return config pointer for chaining, NULL on error
+ * @throws EINVAL if count < config->count, EDOM if values contain NaN
+ * @details Minimizes the total within-bin sum of squared deviations exactly.
+ *          The split point of the best partition is monotone in the end index,
+ *          so each DP row is filled by divide and conquer: O(bins * n log n)
+ *          instead of the textbook O(bins * n^2). Each interior edge is the
+ *          smallest value of the bin it opens.
+ *
+ * @code
+ * stat_float_t* ws = malloc(stat_bin_natural_workspace_size(n) * sizeof(stat_float_t));
+ * stat_size_t* splits = malloc(stat_bin_natural_splits_size(n, 5) * sizeof(stat_size_t));
+ * cfg.count = 5;
+ * stat_bin_natural_f(samples, n, &cfg, ws, splits);
+ * @endcode
+ */
+stat_binning_config_t* stat_bin_natural_f(
+    const stat_float_t* values,
+    stat_size_t count,
+    stat_binning_config_t* config,
+    stat_float_t* workspace,
+    stat_size_t* splits
+);
+
+/** Rules for choosing the number of equal-width bins from the data */
+typedef enum {
+    BIN_RULE_STURGES,           ///< ceil(log2(n)) + 1, assumes roughly normal data
+    BIN_RULE_SCOTT,             ///< Width 3.49 * sigma * n^(-1/3)
+    BIN_RULE_FREEDMAN_DIACONIS, ///< Width 2 * IQR * n^(-1/3), robust to outliers
+    BIN_RULE_DOANE              ///< Sturges corrected for skewness
+} stat_bin_rule_t;
+
+/**
+ * @brief Recommended number of equal-width bins for a dataset
+ * @param values Input data
+ * @param count Number of values
+ * @param rule Bin-count rule
+ * @param workspace Scratch of count elements for BIN_RULE_FREEDMAN_DIACONIS
+ *                  (its quartiles come from selection, not a sort); may be NULL
+ *                  for the other rules
+ * @return Bin count (>= 1), or 0 on error
+ * @throws EINVAL if count=0, EDOM if values contain NaN
+ * @note min, max and the moments come from a single fused pass. Data with zero
+ *       spread yields 1 bin.
+ */
+stat_size_t stat_bin_count_f(
+    const stat_float_t* values,
+    stat_size_t count,
+    stat_bin_rule_t rule,
+    stat_float_t* workspace
+);
+
+/**
+ * @brief Chooses the bin count by rule and builds BIN_LINEAR edges in the workspace
+ * @param[out] config min, max, count, edges and strategy are all filled in;
+ *                    config->edges points into workspace
+ * @param workspace Caller scratch, reused for the edges once the count is known.
+ *                  BIN_RULE_FREEDMAN_DIACONIS needs at least count elements.
+ * @param workspace_size Elements in workspace (>= 2); caps the bins at workspace_size-1
+ * @return config pointer for chaining, NULL on error
+ * @throws EINVAL if count=0, EDOM if values contain NaN, ERANGE if the rule
+ *         asked for more bins than the workspace holds (count is clipped)
+ *
+ * @code
+ * stat_float_t ws[2000];
+ * stat_binning_config_t cfg = {0};
+ * stat_auto_bin_rule_f(dataset, 2000, &cfg, BIN_RULE_FREEDMAN_DIACONIS, ws, 2000);
+ * stat_bin_values_f(dataset, 2000, &cfg, bins, 0); // bins sized cfg.count
+ * @endcode
+ */
+stat_binning_config_t* stat_auto_bin_rule_f(
+    const stat_float_t* values,
+    stat_size_t count,
+    stat_binning_config_t* config,
+    stat_bin_rule_t rule,
+    stat_float_t* workspace,
+    stat_size_t workspace_size
+);
+
+/*
+ * Parallel (sharded) binning
+ *
+ * The input is split into `threads` contiguous chunks (static schedule). Each chunk
+ * is binned into its own private row of the caller's workspace, rows are padded
+ * to STAT_CACHE_LINE so no two shards write the same cache line, and the rows are
+ * combined by a pairwise tree merge before being added to the caller's bins.
+ * Shards run concurrently when built with OpenMP (_OPENMP) and sequentially
+ * otherwise - results are identical either way.
+ */
+
+/** Cache line size in bytes used to pad private bin rows */
+#ifndef STAT_CACHE_LINE
+#define STAT_CACHE_LINE 64
+#endif
+
+/**
+ * @brief Workspace needed by the parallel binning drivers
+ * @param config Binning configuration
+ * @param threads Number of shards (>= 1)
+ * @return Number of stat_size_t elements the caller must allocate
+ *
+ * @code
+ * stat_size_t* ws = malloc(stat_bin_workspace_size(&cfg, 4) * sizeof(stat_size_t));
+ * stat_bin_values_parallel_f(samples, 1000000, &cfg, bins, 0, 4, ws);
+ * free(ws);
+ * @endcode
+ */
+stat_size_t stat_bin_workspace_size(
+    const stat_binning_config_t* config,
+    stat_size_t threads
+);
+
+/**
+ * @brief Sharded stat_bin_values_f() with privatized, cache-line padded bins
+ * @param threads Number of shards/threads (>= 1)
+ * @param workspace Caller-allocated, stat_bin_workspace_size() elements
+ * @throws ERANGE if any value fell outside the edges (it is skipped)
+ */
+void stat_bin_values_parallel_f(
+    const stat_float_t* values,
+    stat_size_t count,
+    const stat_binning_config_t* config,
+    stat_size_t* bins,
+    stat_float_t epsilon,
+    stat_size_t threads,
+    stat_size_t* workspace
+);
+
+/**
+ * @brief Sharded stat_bin_values_i() with privatized, cache-line padded bins
+ * @param threads Number of shards/threads (>= 1)
+ * @param workspace Caller-allocated, stat_bin_workspace_size() elements
+ * @throws ERANGE if any value fell outside the edges (it is skipped)
+ */
+void stat_bin_values_parallel_i(
+    const stat_int_t* values,
+    stat_size_t count,
+    const stat_binning_config_t* config,
+    stat_size_t* bins,
+    stat_size_t threads,
+    stat_size_t* workspace
+);
+
+/*
+ * 2D histograms
+ *
+ * Joint binning of (x, y) pairs on two independent axes. Counts are a row-major
+ * matrix of y_axis->count rows by x_axis->count columns: counts[y * x_axis->count + x].
+ * Each axis uses the same lookup kernel as stat_bin_values_f().
+ */
+
+/**
+ * @brief Bins (xs[i], ys[i]) pairs into a caller-allocated count matrix
+ * @param xs Column-axis values
+ * @param ys Row-axis values
+ * @param count Number of pairs
+ * @param x_axis Column binning configuration
+ * @param y_axis Row binning configuration
+ * @param[out] counts Caller-allocated matrix of x_axis->count * y_axis->count (counts are added)
+ * @param epsilon Edge tolerance, as for stat_bin_values_f()
+ * @return counts pointer for chaining
+ * @throws ERANGE if either coordinate of any pair fell outside its edges (pair skipped)
+ *
+ * @code
+ * stat_size_t joint[10 * 8] = {0}; // 8 latency rows, 10 payload columns
+ * stat_bin_values_2d_f(payload, latency, n, &payload_cfg, &latency_cfg, joint, 0);
+ * stat_graph_heatmap(joint, &payload_cfg, &latency_cfg, true);
+ * @endcode
+ */
+stat_size_t* stat_bin_values_2d_f(
+    const stat_float_t* xs,
+    const stat_float_t* ys,
+    stat_size_t count,
+    const stat_binning_config_t* x_axis,
+    const stat_binning_config_t* y_axis,
+    stat_size_t* counts,
+    stat_float_t epsilon
+);
+
+/**
+ * @brief Workspace needed by stat_bin_values_2d_parallel_f()
+ * @return Number of stat_size_t elements: one cache-line padded tile per thread
+ */
+stat_size_t stat_bin2d_workspace_size(
+    const stat_binning_config_t* x_axis,
+    const stat_binning_config_t* y_axis,
+    stat_size_t threads
+);
+
+/**
+ * @brief Sharded stat_bin_values_2d_f() with privatized tiles and a tree merge
+ * @param threads Number of shards/threads (>= 1)
+ * @param workspace Caller-allocated, stat_bin2d_workspace_size() elements
+ * @return counts pointer for chaining
+ * @throws ERANGE if any pair fell outside the edges
+ */
+stat_size_t* stat_bin_values_2d_parallel_f(
+    const stat_float_t* xs,
+    const stat_float_t* ys,
+    stat_size_t count,
+    const stat_binning_config_t* x_axis,
+    const stat_binning_config_t* y_axis,
+    stat_size_t* counts,
+    stat_float_t epsilon,
+    stat_size_t threads,
+    stat_size_t* workspace
+);
+
+/**
+ * @brief Column totals of a 2D count matrix (distribution of x alone)
+ * @param[out] x_bins Caller-allocated, x_axis->count elements (overwritten)
+ * @return x_bins pointer for chaining
+ */
+stat_size_t* stat_bin2d_marginal_x(
+    const stat_size_t* counts,
+    const stat_binning_config_t* x_axis,
+    const stat_binning_config_t* y_axis,
+    stat_size_t* x_bins
+);
+
+/**
+ * @brief Row totals of a 2D count matrix (distribution of y alone)
+ * @param[out] y_bins Caller-allocated, y_axis->count elements (overwritten)
+ * @return y_bins pointer for chaining
+ */
+stat_size_t* stat_bin2d_marginal_y(
+    const stat_size_t* counts,
+    const stat_binning_config_t* x_axis,
+    const stat_binning_config_t* y_axis,
+    stat_size_t* y_bins
+);
+
 /* Utility functions (remain unchanged) */
 stat_float_t stat_bin_center(const stat_binning_config_t* config, stat_size_t bin_idx);
 stat_float_t stat_bin_width(const stat_binning_config_t* config, stat_size_t bin_idx);
@@ -1,5 +1,6 @@
 #include "stat_central.h"
 #include "stat_util.h"
+#include "stat_percentiles.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -78,12 +79,7 @@ stat_float_t stat_median_f(const stat_float_t* data, stat_size_t count) {
     memcpy(sorted, data, count * sizeof(stat_float_t));
     stat_sort_f(sorted, count);
 
-    stat_float_t result;
-    if (count % 2 == 1) {
-        result = sorted[count / 2];
-    } else {
-        result = (sorted[count/2 - 1] + sorted[count/2]) / 2.0f;
-    }
+    stat_float_t result = stat_median_sorted_f(sorted, count);
 
     free(sorted);
     return result;
@@ -108,17 +104,30 @@ bool stat_mode_f(const stat_float_t* data, stat_size_t count, stat_float_t* mode
     memcpy(sorted, data, count * sizeof(stat_float_t));
     stat_sort_f(sorted, count);
 
+    bool result = stat_mode_sorted_f(sorted, count, modes, mode_count);
+    free(sorted);
+    return result;
+}
+
+bool stat_mode_sorted_f(const stat_float_t* sorted, stat_size_t count, stat_float_t* modes, stat_size_t* mode_count) {
+    assert(sorted != NULL && "Input array cannot be NULL");
+    assert(modes != NULL && "Output array cannot be NULL");
+    assert(mode_count != NULL && "Mode count pointer cannot be NULL");
+
+    if (count == 0) {
+        errno = EINVAL;
+        return false;
+    }
+
     // Check for NaN
     for (stat_size_t i = 0; i < count; i++) {
         if (isnan(sorted[i])) {
-            free(sorted);
             errno = EDOM;
             return false;
         }
     }
 
     private_find_modes(sorted, count, modes, mode_count);
-    free(sorted);
     return true;
 }
 
@@ -38,6 +38,19 @@ stat_float_t stat_median_f(const stat_float_t* data, stat_size_t count);
  */
 bool stat_mode_f(const stat_float_t* data, stat_size_t count, stat_float_t* modes, stat_size_t* mode_count);
 
+/**
+ * @brief Finds mode(s) of a float array already sorted in ascending order
+ * @param[in] sorted Sorted input array (must not be NULL)
+ * @param[in] count Number of elements
+ * @param[out] modes Pre-allocated output array (size >= count)
+ * @param[out] mode_count Number of modes found
+ * @return True on success, False on error
+ * @throws EINVAL if count=0, EDOM if NaN encountered
+ * @assert Fails if sorted or modes is NULL
+ * @note Zero-copy - neither copies nor modifies the input
+ */
+bool stat_mode_sorted_f(const stat_float_t* sorted, stat_size_t count, stat_float_t* modes, stat_size_t* mode_count);
+
 // Integer versions (return float for mean/median)
 stat_float_t stat_mean_i(const stat_int_t* data, stat_size_t count);
 stat_float_t stat_median_i(const stat_int_t* data, stat_size_t count);
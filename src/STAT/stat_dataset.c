@@ -0,0 +1,236 @@
+#include "stat_dataset.h"
+#include "stat_central.h"
+#include "stat_percentiles.h"
+#include "stat_util.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Welford single pass: min, max, mean and M2 together
+static void private_compute_moments(stat_dataset_t* ds) {
+    stat_float_t min = ds->data[0], max = ds->data[0];
+    stat_float_t mean = 0.0, m2 = 0.0;
+
+    for (stat_size_t i = 0; i < ds->count; i++) {
+        const stat_float_t x = ds->data[i];
+        if (isnan(x)) {
+            ds->min = ds->max = ds->mean = ds->variance = NAN;
+            ds->has_moments = true;
+            errno = EDOM;
+            return;
+        }
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+        const stat_float_t delta = x - mean;
+        mean += delta / (i + 1);
+        m2 += delta * (x - mean);
+    }
+
+    ds->min = min;
+    ds->max = max;
+    ds->mean = mean;
+    ds->variance = (ds->count > 1) ? m2 / (ds->count - 1) : NAN;
+    ds->has_moments = true;
+}
+
+static bool private_ensure_moments(stat_dataset_t* ds) {
+    assert(ds != NULL && "Dataset cannot be NULL");
+    if (ds->count == 0) {
+        errno = EINVAL;
+        return false;
+    }
+    if (!ds->has_moments) {
+        private_compute_moments(ds);
+    }
+    return true;
+}
+
+stat_dataset_t* stat_dataset_init(stat_dataset_t* ds, const stat_float_t* data, stat_size_t count, stat_float_t* sorted_workspace) {
+    assert(ds != NULL && "Dataset cannot be NULL");
+    assert(data != NULL && "Input array cannot be NULL");
+
+    memset(ds, 0, sizeof(*ds));
+    ds->data = data;
+    ds->count = count;
+    ds->sorted = sorted_workspace;
+
+    if (count == 0) {
+        errno = EINVAL;
+    }
+    return ds;
+}
+
+stat_dataset_t* stat_dataset_init_copy(stat_dataset_t* ds, const stat_float_t* data, stat_size_t count) {
+    assert(ds != NULL && "Dataset cannot be NULL");
+    assert(data != NULL && "Input array cannot be NULL");
+
+    memset(ds, 0, sizeof(*ds));
+    if (count == 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    stat_float_t* copy = malloc(count * sizeof(stat_float_t));
+    if (!copy) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    memcpy(copy, data, count * sizeof(stat_float_t));
+
+    ds->data = copy;
+    ds->count = count;
+    ds->owns_data = true;
+    return ds;
+}
+
+void stat_dataset_invalidate(stat_dataset_t* ds) {
+    assert(ds != NULL && "Dataset cannot be NULL");
+    ds->has_sorted = false;
+    ds->has_moments = false;
+}
+
+void stat_dataset_free(stat_dataset_t* ds) {
+    if (!ds) return;
+    if (ds->owns_sorted) {
+        free(ds->sorted);
+    }
+    if (ds->owns_data) {
+        free((stat_float_t*)ds->data);
+    }
+    memset(ds, 0, sizeof(*ds));
+}
+
+const stat_float_t* stat_dataset_sorted(stat_dataset_t* ds) {
+    assert(ds != NULL && "Dataset cannot be NULL");
+
+    if (ds->count == 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+    if (ds->has_sorted) {
+        return ds->sorted;
+    }
+
+    if (!ds->sorted) {
+        ds->sorted = malloc(ds->count * sizeof(stat_float_t));
+        if (!ds->sorted) {
+            errno = ENOMEM;
+            return NULL;
+        }
+        ds->owns_sorted = true;
+    }
+
+    memcpy(ds->sorted, ds->data, ds->count * sizeof(stat_float_t));
+    stat_sort_f(ds->sorted, ds->count);
+    ds->has_sorted = true;
+    return ds->sorted;
+}
+
+// ========================
+// Moments
+// ========================
+
+stat_float_t stat_dataset_min(stat_dataset_t* ds) {
+    return private_ensure_moments(ds) ? ds->min : NAN;
+}
+
+stat_float_t stat_dataset_max(stat_dataset_t* ds) {
+    return private_ensure_moments(ds) ? ds->max : NAN;
+}
+
+stat_float_t stat_dataset_range(stat_dataset_t* ds) {
+    return private_ensure_moments(ds) ? ds->max - ds->min : NAN;
+}
+
+stat_float_t stat_dataset_mean(stat_dataset_t* ds) {
+    return private_ensure_moments(ds) ? ds->mean : NAN;
+}
+
+stat_float_t stat_dataset_variance(stat_dataset_t* ds) {
+    if (!private_ensure_moments(ds)) {
+        return NAN;
+    }
+    if (isnan(ds->variance)) {
+        errno = EDOM;
+    }
+    return ds->variance;
+}
+
+stat_float_t stat_dataset_std_dev(stat_dataset_t* ds) {
+    stat_float_t var = stat_dataset_variance(ds);
+    return isnan(var) ? NAN : sqrt(var);
+}
+
+// ========================
+// Order Statistics
+// ========================
+
+stat_float_t stat_dataset_median(stat_dataset_t* ds) {
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    return sorted ? stat_median_sorted_f(sorted, ds->count) : NAN;
+}
+
+stat_float_t stat_dataset_percentile(stat_dataset_t* ds, stat_float_t percentile) {
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    return sorted ? stat_percentile_sorted_f(sorted, ds->count, percentile) : NAN;
+}
+
+stat_float_t stat_dataset_interquartile_range(stat_dataset_t* ds) {
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    return sorted ? stat_iqr_sorted_f(sorted, ds->count) : NAN;
+}
+
+stat_float_t* stat_dataset_percentiles(stat_dataset_t* ds, const stat_float_t* percentiles, stat_float_t* results, stat_size_t p_count) {
+    assert(percentiles != NULL && "Percentiles pointer cannot be NULL");
+    assert(results != NULL && "Results pointer cannot be NULL");
+
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    if (!sorted) {
+        for (stat_size_t i = 0; i < p_count; i++) {
+            results[i] = NAN;
+        }
+        return results;
+    }
+    return stat_percentiles_sorted_f(sorted, ds->count, percentiles, results, p_count);
+}
+
+stat_five_num_summary_t stat_dataset_five_num_summary(stat_dataset_t* ds) {
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    if (!sorted) {
+        stat_five_num_summary_t empty = {0};
+        return empty;
+    }
+    return stat_five_num_summary_sorted_f(sorted, ds->count);
+}
+
+bool stat_dataset_mode(stat_dataset_t* ds, stat_float_t* modes, stat_size_t* mode_count) {
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    return sorted ? stat_mode_sorted_f(sorted, ds->count, modes, mode_count) : false;
+}
+
+stat_summary_t stat_dataset_describe(stat_dataset_t* ds) {
+    stat_summary_t summary = {0};
+    if (!private_ensure_moments(ds)) {
+        return summary;
+    }
+
+    summary.count = ds->count;
+    summary.min = ds->min;
+    summary.max = ds->max;
+    summary.mean = ds->mean;
+    summary.variance = ds->variance;
+    summary.stddev = isnan(ds->variance) ? NAN : sqrt(ds->variance);
+
+    const stat_float_t* sorted = stat_dataset_sorted(ds);
+    if (!sorted) {
+        summary.median = summary.q25 = summary.q75 = NAN;
+        return summary;
+    }
+    summary.median = stat_median_sorted_f(sorted, ds->count);
+    summary.q25 = stat_percentile_sorted_f(sorted, ds->count, 25.0f);
+    summary.q75 = stat_percentile_sorted_f(sorted, ds->count, 75.0f);
+    return summary;
+}
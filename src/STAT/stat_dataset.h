@@ -0,0 +1,150 @@
+#ifndef STAT_DATASET_H
+#define STAT_DATASET_H
+
+#include "stat_types.h"
+#include "stat_describe.h"
+#include <stdbool.h>
+
+/**
+ * @file stat_dataset.h
+ * @brief Dataset handle that caches order statistics and moments
+ *
+ * Calling stat_median_f(), stat_five_num_summary_f(), stat_mode_f() etc. on the
+ * same array sorts a fresh copy every time. A stat_dataset_t sorts its data at
+ * most once, on the first order-statistic query, and computes min/max/mean/variance
+ * in a single fused pass on the first moment query. Every accessor reuses the cache.
+ *
+ * @code
+ * stat_dataset_t ds;
+ * stat_dataset_init(&ds, samples, 1000, NULL); // borrow samples, lazily malloc sorted copy
+ *
+ * stat_float_t med = stat_dataset_median(&ds);         // sorts once
+ * stat_five_num_summary_t fns = stat_dataset_five_num_summary(&ds); // O(1)
+ * stat_summary_t sum = stat_dataset_describe(&ds);     // no further sorting
+ *
+ * stat_dataset_free(&ds);
+ * @endcode
+ */
+
+typedef struct {
+    const stat_float_t* data;  ///< Input values (borrowed or owned)
+    stat_size_t count;         ///< Number of values
+    stat_float_t* sorted;      ///< Cached ascending copy (valid when has_sorted)
+    stat_float_t min;          ///< Cached minimum (valid when has_moments)
+    stat_float_t max;          ///< Cached maximum (valid when has_moments)
+    stat_float_t mean;         ///< Cached arithmetic mean (valid when has_moments)
+    stat_float_t variance;     ///< Cached sample variance (valid when has_moments)
+    bool owns_data;            ///< data was copied by stat_dataset_init_copy()
+    bool owns_sorted;          ///< sorted was allocated by the dataset
+    bool has_sorted;           ///< sorted holds an up-to-date ascending copy
+    bool has_moments;          ///< min/max/mean/variance are up to date
+} stat_dataset_t;
+
+// ========================
+// Lifetime
+// ========================
+
+/**
+ * @brief Initializes a dataset that borrows the caller's data
+ * @param[out] ds Dataset handle to initialize
+ * @param[in] data Input array (must outlive the handle and must not change
+ *                 without a call to stat_dataset_invalidate())
+ * @param[in] count Number of elements
+ * @param[in] sorted_workspace Optional caller buffer of count elements for the
+ *                 sorted copy. NULL lets the dataset malloc it on first use.
+ * @return ds pointer for chaining
+ * @throws EINVAL if count=0
+ * @assert Fails if ds or data is NULL
+ */
+stat_dataset_t* stat_dataset_init(stat_dataset_t* ds, const stat_float_t* data, stat_size_t count, stat_float_t* sorted_workspace);
+
+/**
+ * @brief Initializes a dataset that owns a private copy of the data
+ * @param[out] ds Dataset handle to initialize
+ * @param[in] data Input array (copied - the caller may reuse it immediately)
+ * @param[in] count Number of elements
+ * @return ds pointer for chaining, or NULL on failure
+ * @throws EINVAL if count=0, ENOMEM if the copy cannot be allocated
+ * @assert Fails if ds or data is NULL
+ */
+stat_dataset_t* stat_dataset_init_copy(stat_dataset_t* ds, const stat_float_t* data, stat_size_t count);
+
+/**
+ * @brief Discards all cached statistics (call after modifying borrowed data)
+ * @param[in,out] ds Dataset handle
+ * @assert Fails if ds is NULL
+ */
+void stat_dataset_invalidate(stat_dataset_t* ds);
+
+/**
+ * @brief Releases any buffers owned by the dataset
+ * @param[in,out] ds Dataset handle (may be re-initialized afterwards)
+ * @note Borrowed data and caller-provided workspaces are never freed
+ */
+void stat_dataset_free(stat_dataset_t* ds);
+
+// ========================
+// Cache Access
+// ========================
+
+/**
+ * @brief Returns the cached ascending copy, sorting on first use
+ * @param[in,out] ds Dataset handle
+ * @return Pointer to count sorted values, or NULL on failure
+ * @throws ENOMEM if the sorted copy cannot be allocated
+ * @note Valid until stat_dataset_invalidate() or stat_dataset_free()
+ */
+const stat_float_t* stat_dataset_sorted(stat_dataset_t* ds);
+
+// ========================
+// Moments (single fused pass, no sorting)
+// ========================
+
+stat_float_t stat_dataset_min(stat_dataset_t* ds);
+stat_float_t stat_dataset_max(stat_dataset_t* ds);
+stat_float_t stat_dataset_range(stat_dataset_t* ds);
+stat_float_t stat_dataset_mean(stat_dataset_t* ds);
+
+/**
+ * @brief Sample variance (Bessel's correction) from the cached moments
+ * @return Variance, or NAN with errno=EDOM if count < 2 or NaN encountered
+ */
+stat_float_t stat_dataset_variance(stat_dataset_t* ds);
+stat_float_t stat_dataset_std_dev(stat_dataset_t* ds);
+
+// ========================
+// Order Statistics (sort at most once)
+// ========================
+
+stat_float_t stat_dataset_median(stat_dataset_t* ds);
+stat_float_t stat_dataset_percentile(stat_dataset_t* ds, stat_float_t percentile);
+stat_float_t stat_dataset_interquartile_range(stat_dataset_t* ds);
+
+/**
+ * @brief Computes several percentiles from the cached sorted copy
+ * @param[in,out] ds Dataset handle
+ * @param[in] percentiles Desired percentiles (0.0 to 100.0 each), any order
+ * @param[out] results Pre-allocated output, results[i] matches percentiles[i]
+ * @param[in] p_count Number of percentiles
+ * @return results pointer for chaining
+ */
+stat_float_t* stat_dataset_percentiles(stat_dataset_t* ds, const stat_float_t* percentiles, stat_float_t* results, stat_size_t p_count);
+
+stat_five_num_summary_t stat_dataset_five_num_summary(stat_dataset_t* ds);
+
+/**
+ * @brief Finds mode(s) from the cached sorted copy
+ * @param[out] modes Pre-allocated output array (size >= count)
+ * @param[out] mode_count Number of modes found
+ * @return True on success, False on error
+ */
+bool stat_dataset_mode(stat_dataset_t* ds, stat_float_t* modes, stat_size_t* mode_count);
+
+/**
+ * @brief Full descriptive summary - one fused moment pass plus at most one sort
+ * @param[in,out] ds Dataset handle
+ * @return stat_summary_t structure with all metrics
+ */
+stat_summary_t stat_dataset_describe(stat_dataset_t* ds);
+
+#endif // STAT_DATASET_H
@@ -7,10 +7,10 @@
 
 #include "stat_basic.h"
 #include "stat_central.h"
+#include "stat_dataset.h"
 #include "stat_util.h"
 #include "errno.h"
 
-/*
 stat_summary_t stat_describe_f(const stat_float_t* data, stat_size_t count) {
     assert(data != NULL && "Input array cannot be NULL");
 
@@ -20,35 +20,15 @@ stat_summary_t stat_describe_f(const stat_float_t* data, stat_size_t count) {
         return summary;
     }
 
-    // Create a copy for operations that need sorting
-    stat_float_t* copy = malloc(count * sizeof(stat_float_t));
-    if (!copy) {
-        errno = ENOMEM;
-        return summary;
-    }
-    memcpy(copy, data, count * sizeof(stat_float_t));
-
-    // Basic metrics
-    summary.count = count;
-    summary.min = stat_min_f(data, count);
-    summary.max = stat_max_f(data, count);
-    summary.mean = stat_mean_f(data, count);
-
-    // Variance/stddev
-    summary.variance = stat_variance_f(data, count, true);
-    summary.stddev = sqrt(summary.variance);
-
-    // Percentiles (requires sorted data)
-    stat_sort_f(copy, count);
-    summary.median = stat_median_f(copy, count);
-    summary.q25 = 0;//stat_percentile_f(copy, count, 25.0f);
-    summary.q75 = 0;//stat_percentile_f(copy, count, 75.0f);
-
-    free(copy);
+    // Dataset handle: one fused moment pass, one sort shared by all percentiles
+    stat_dataset_t ds;
+    stat_dataset_init(&ds, data, count, NULL);
+    summary = stat_dataset_describe(&ds);
+    stat_dataset_free(&ds);
     return summary;
 }
 
-stat_summary_t stat_describe_i32(const stat_int_t* data, stat_size_t count) {
+stat_summary_t stat_describe_i(const stat_int_t* data, stat_size_t count) {
     assert(data != NULL && "Input array cannot be NULL");
 
     stat_summary_t summary = {0};
@@ -63,12 +43,9 @@ stat_summary_t stat_describe_i32(const stat_int_t* data, stat_size_t count) {
         errno = ENOMEM;
         return summary;
     }
-    for (stat_size_t i = 0; i < count; i++) {
-        fdata[i] = (stat_float_t)data[i];
-    }
+    stat_cast_int_to_float_array(fdata, data, count);
 
-    //summary = stat_describe_f(fdata, count);
+    summary = stat_describe_f(fdata, count);
     free(fdata);
     return summary;
 }
-*/
@@ -51,11 +51,10 @@ stat_float_t stat_interquartile_range_f(stat_float_t* data, stat_size_t count) {
     memcpy(sorted, data, count * sizeof(stat_float_t));
     stat_sort_f(sorted, count);
 
-    stat_float_t q1 = stat_percentile_f(sorted, count, 25.0f);
-    stat_float_t q3 = stat_percentile_f(sorted, count, 75.0f);
+    stat_float_t iqr = stat_iqr_sorted_f(sorted, count);
 
     free(sorted);
-    return q3 - q1;
+    return iqr;
 }
 
 stat_float_t stat_mean_absolute_deviation_f(stat_float_t* data, stat_size_t count, stat_float_t scale) {
@@ -136,7 +135,7 @@ stat_float_t stat_qn_estimator_f(stat_float_t* data, stat_size_t count) {
 
     // Find first quartile of differences
     stat_sort_f(diffs, n_pairs);
-    stat_float_t qn = stat_percentile_f(diffs, n_pairs, 25.0f);
+    stat_float_t qn = stat_percentile_sorted_f(diffs, n_pairs, 25.0f);
 
     free(diffs);
     return qn * 2.21914f; // Scaling factor for consistency
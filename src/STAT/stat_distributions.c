@@ -7,6 +7,57 @@
 #include "stat_constants.h"
 #include "../PRNG/prng.h"
 
+// ========================
+// Bulk uniform pools
+// ========================
+
+/*
+ * Rejection samplers consume a variable number of uniforms per output, so they
+ * draw from a small buffer refilled by one prng_fill_*() call instead of going
+ * through the engine dispatch for every value. Unused pool entries are dropped
+ * when the generator returns. Kept small for 16-bit stacks.
+ */
+#define PRIVATE_POOL_SIZE 64
+
+typedef struct {
+    double u[PRIVATE_POOL_SIZE];
+    unsigned pos;
+    prng_state_t* state;
+} private_pool_t;
+
+typedef struct {
+    uint32_t bits[PRIVATE_POOL_SIZE];
+    unsigned pos;
+    prng_state_t* state;
+} private_bits_pool_t;
+
+static void private_pool_init(private_pool_t* pool, prng_state_t* state) {
+    pool->state = state;
+    pool->pos = PRIVATE_POOL_SIZE;
+}
+
+// Uniform in [0, 1)
+static double private_pool_next(private_pool_t* pool) {
+    if (pool->pos == PRIVATE_POOL_SIZE) {
+        prng_fill_double(pool->state, pool->u, PRIVATE_POOL_SIZE);
+        pool->pos = 0;
+    }
+    return pool->u[pool->pos++];
+}
+
+static void private_bits_init(private_bits_pool_t* pool, prng_state_t* state) {
+    pool->state = state;
+    pool->pos = PRIVATE_POOL_SIZE;
+}
+
+static uint32_t private_bits_next(private_bits_pool_t* pool) {
+    if (pool->pos == PRIVATE_POOL_SIZE) {
+        prng_fill_u32(pool->state, pool->bits, PRIVATE_POOL_SIZE);
+        pool->pos = 0;
+    }
+    return pool->bits[pool->pos++];
+}
+
 void stat_generate_uniform_dist(
     stat_float_t* output,
     stat_size_t size,
@@ -23,9 +74,9 @@ void stat_generate_uniform_dist(
     }
 
     const stat_float_t range = max - min;
+    prng_fill_double(state, output, size);
     for (stat_size_t i = 0; i < size; i++) {
-        printf("%f ", prng_next_float(state));
-        output[i] = min + prng_next_float(state) * range;
+        output[i] = min + output[i] * range;
     }
 }
 
@@ -43,20 +94,232 @@ void stat_generate_normal_dist(
         return;
     }
 
-    // Box-Muller transform (generates pairs)
+    // Box-Muller transform (generates pairs) over uniforms filled in place
+    const stat_size_t pairs = size & ~(stat_size_t)1;
+    prng_fill_double(state, output, pairs);
+
     for (stat_size_t i = 0; i < size; i += 2) {
-        const stat_float_t u1 = prng_next_float(state);
-        const stat_float_t u2 = prng_next_float(state);
+        stat_float_t u[2];
+        if (i < pairs) {
+            u[0] = output[i];
+            u[1] = output[i+1];
+        } else {
+            prng_fill_double(state, u, 2); // odd size: one more pair for the last value
+        }
 
-        const stat_float_t mag = std_dev * sqrt(-2.0f * log(u1));
-        const stat_float_t z0 = mag * cos(TWO_PI * u2) + mean;
-        const stat_float_t z1 = mag * sin(TWO_PI * u2) + mean;
+        const stat_float_t mag = std_dev * sqrt(-2.0f * log(1.0 - u[0])); // u1 may be 0, 1-u1 never is
+        const stat_float_t z0 = mag * cos(TWO_PI * u[1]) + mean;
+        const stat_float_t z1 = mag * sin(TWO_PI * u[1]) + mean;
 
         output[i] = z0;
         if (i + 1 < size) output[i+1] = z1;
     }
 }
 
+// ========================
+// Ziggurat tables
+// ========================
+
+#define PRIVATE_ZIG_LAYERS STAT_ZIGGURAT_LAYERS
+#define PRIVATE_ZIG_R 3.442619855899 ///< Start of the tail
+#define PRIVATE_INV_2POW32 (1.0 / 4294967296.0)
+/*
+ * Marsaglia & Tsang (2000) 128-layer tables, rescaled to a 24-bit magnitude:
+ * k[i] - accept threshold for layer i (x fully inside the next layer down)
+ * w[i] - layer width / 2^24
+ * f[i] - exp(-x^2/2) at the layer edge
+ */
+static const uint32_t private_zig_k[PRIVATE_ZIG_LAYERS] = {
+    0xED5A44u, 0x000000u, 0xC01E36u, 0xD9C88Fu, 0xE4B68Du, 0xEAC00Au, 0xEE9243u, 0xF1344Bu,
+    0xF3208Bu, 0xF4979Cu, 0xF5BEC5u, 0xF6AD05u, 0xF77151u, 0xF815CEu, 0xF8A199u, 0xF919D8u,
+    0xF98259u, 0xF9DDFDu, 0xFA2EFCu, 0xFA7711u, 0xFAB79Cu, 0xFAF1BAu, 0xFB2651u, 0xFB561Cu,
+    0xFB81BAu, 0xFBA9ADu, 0xFBCE63u, 0xFBF039u, 0xFC0F81u, 0xFC2C7Du, 0xFC476Bu, 0xFC607Bu,
+    0xFC77DDu, 0xFC8DB6u, 0xFCA22Au, 0xFCB557u, 0xFCC757u, 0xFCD844u, 0xFCE832u, 0xFCF734u,
+    0xFD055Bu, 0xFD12B8u, 0xFD1F58u, 0xFD2B47u, 0xFD3692u, 0xFD4141u, 0xFD4B60u, 0xFD54F5u,
+    0xFD5E09u, 0xFD66A4u, 0xFD6ECBu, 0xFD7684u, 0xFD7DD5u, 0xFD84C4u, 0xFD8B53u, 0xFD9188u,
+    0xFD9766u, 0xFD9CF1u, 0xFDA22Cu, 0xFDA71Au, 0xFDABBEu, 0xFDB019u, 0xFDB42Eu, 0xFDB800u,
+    0xFDBB8Fu, 0xFDBEDDu, 0xFDC1ECu, 0xFDC4BDu, 0xFDC751u, 0xFDC9A8u, 0xFDCBC4u, 0xFDCDA5u,
+    0xFDCF4Cu, 0xFDD0B8u, 0xFDD1E9u, 0xFDD2E0u, 0xFDD39Cu, 0xFDD41Du, 0xFDD462u, 0xFDD46Au,
+    0xFDD435u, 0xFDD3C0u, 0xFDD30Cu, 0xFDD215u, 0xFDD0DAu, 0xFDCF58u, 0xFDCD8Eu, 0xFDCB79u,
+    0xFDC914u, 0xFDC65Du, 0xFDC350u, 0xFDBFE8u, 0xFDBC1Fu, 0xFDB7F1u, 0xFDB357u, 0xFDAE49u,
+    0xFDA8BFu, 0xFDA2B0u, 0xFD9C12u, 0xFD94D9u, 0xFD8CF7u, 0xFD845Du, 0xFD7AFAu, 0xFD70B8u,
+    0xFD6580u, 0xFD5938u, 0xFD4BBEu, 0xFD3CEDu, 0xFD2C98u, 0xFD1A89u, 0xFD0680u, 0xFCF02Eu,
+    0xFCD732u, 0xFCBB14u, 0xFC9B3Bu, 0xFC76E6u, 0xFC4D18u, 0xFC1C7Fu, 0xFBE354u, 0xFB9F18u,
+    0xFB4C34u, 0xFAE541u, 0xFA61C1u, 0xF9B369u, 0xF8C01Eu, 0xF75217u, 0xF4E442u, 0xEFACC9u,
+};
+static const stat_float_t private_zig_w[PRIVATE_ZIG_LAYERS] = {
+    2.21317186757478148e-07, 1.62315884121635359e-08, 2.16288227496762252e-08, 2.54242412063731858e-08,
+    2.84575126943999419e-08, 3.10335182405746322e-08, 3.33006488328090424e-08, 3.53433455509810637e-08,
+    3.72146724066764535e-08, 3.89503621304020434e-08, 4.05757378738614695e-08, 4.21094662747047224e-08,
+    4.35657447959476017e-08, 4.49556508334908260e-08, 4.62880127367234175e-08, 4.75699937727485246e-08,
+    4.88074962318156536e-08, 5.00054487167344917e-08, 5.11680151935704477e-08, 5.22987502284600361e-08,
+    5.34007163394056371e-08, 5.44765741242785619e-08, 5.55286524662465350e-08, 5.65590039200369383e-08,
+    5.75694489122122464e-08, 5.85616113850730068e-08, 5.95369478161921256e-08, 6.04967710525590483e-08,
+    6.14422700445768578e-08, 6.23745263078239777e-08, 6.32945277508988537e-08, 6.42031803663310827e-08,
+    6.51013181750343662e-08, 6.59897117337009922e-08, 6.68690754522408387e-08, 6.77400739200807078e-08,
+    6.86033274024049887e-08, 6.94594166377039219e-08, 7.03088870444290733e-08, 7.11522524257378987e-08,
+    7.19899982461899317e-08, 7.28225845420358410e-08, 7.36504485168077146e-08, 7.44740068658034928e-08,
+    7.52936578663957753e-08, 7.61097832655999439e-08, 7.69227499917862683e-08, 7.77329117136369247e-08,
+    7.85406102662929342e-08, 7.93461769619957970e-08, 8.01499338003126959e-08, 8.09521945911731441e-08,
+    8.17532660023774259e-08, 8.25534485419185063e-08, 8.33530374843481371e-08, 8.41523237494860706e-08,
+    8.49515947409904060e-08, 8.57511351516582694e-08, 8.65512277417912822e-08, 8.73521540965265542e-08,
+    8.81541953676893815e-08, 8.89576330054613379e-08, 8.97627494849683803e-08, 9.05698290327751704e-08,
+    9.13791583582188671e-08, 9.21910273945278167e-08, 9.30057300547462068e-08, 9.38235650076270591e-08,
+    9.46448364788637228e-08, 9.54698550833093009e-08, 9.62989386941886521e-08, 9.71324133557459516e-08,
+    9.79706142463009686e-08, 9.88138866993203248e-08, 9.96625872908592766e-08, 1.00517085002611168e-07,
+    1.01377762470836452e-07, 1.02245017332653260e-07, 1.03119263682587773e-07, 1.04000933653938791e-07,
+    1.04890479141449538e-07, 1.05788373684052794e-07, 1.06695114529124416e-07, 1.07611224902822284e-07,
+    1.08537256514795156e-07, 1.09473792329934002e-07, 1.10421449645047850e-07, 1.11380883514552632e-07,
+    1.12352790576682033e-07, 1.13337913340637153e-07, 1.14337045005828729e-07, 1.15351034897364548e-07,
+    1.16380794617745677e-07, 1.17427305034060867e-07, 1.18491624243713613e-07, 1.19574896691052442e-07,
+    1.20678363643728824e-07, 1.21803375283185699e-07, 1.22951404721040036e-07, 1.24124064325810483e-07,
+    1.25323124837233931e-07, 1.26550537864802872e-07, 1.27808462522053441e-07, 1.29099297150905248e-07,
+    1.30425717358353685e-07, 1.31790721945685352e-07, 1.33197688793598382e-07, 1.34650443426918896e-07,
+    1.36153343896715150e-07, 1.37711386901066481e-07, 1.39330341895773219e-07, 1.41016922600128567e-07,
+    1.42779009223643688e-07, 1.44625940652713168e-07, 1.46568904960860639e-07, 1.48621471053086049e-07,
+    1.50800327801038471e-07, 1.53126336689289676e-07, 1.55626073386183225e-07, 1.58334160522303562e-07,
+    1.61296938247789118e-07, 1.64578519605825952e-07, 1.68271383675867942e-07, 1.72516346396298941e-07,
+    1.77544132032858149e-07, 1.83774760855249662e-07, 1.92110835586854313e-07, 2.05196133607566369e-07,
+};
+static const stat_float_t private_zig_f[PRIVATE_ZIG_LAYERS] = {
+    1.00000000000000000e+00, 9.63599693127086154e-01, 9.36282681685059570e-01, 9.13043647971740202e-01,
+    8.92281650784026104e-01, 8.73243048910069541e-01, 8.55500607869450591e-01, 8.38783605295989609e-01,
+    8.22907211381408987e-01, 8.07738294682960545e-01, 7.93177011771305063e-01, 7.79146085929687704e-01,
+    7.65584173897704501e-01, 7.52441559174611418e-01, 7.39677243672647311e-01, 7.27256918344184822e-01,
+    7.15151507410498599e-01, 7.03336099016158123e-01, 6.91789143436675080e-01, 6.80491840997334063e-01,
+    6.69427667348890365e-01, 6.58582000050088046e-01, 6.47941821110222471e-01, 6.37495477335042304e-01,
+    6.27232485249927252e-01, 6.17143370818880932e-01, 6.07219536625120293e-01, 5.97453150944516675e-01,
+    5.87837054434706574e-01, 5.78364681119763135e-01, 5.69029991067950935e-01, 5.59827412704086869e-01,
+    5.50751793114604538e-01, 5.41798355025425504e-01, 5.32962659383836135e-01, 5.24240572672984073e-01,
+    5.15628238244001835e-01, 5.07122051075568958e-01, 4.98718635470979499e-01, 4.90414825283844114e-01,
+    4.82207646329485207e-01, 4.74094300693016946e-01, 4.66072152689456121e-01, 4.58138716267872059e-01,
+    4.50291643682039222e-01, 4.42528715275468443e-01, 4.34847830249990908e-01, 4.27246998304996073e-01,
+    4.19724332049574378e-01, 4.12278040102661003e-01, 4.04906420807222944e-01, 3.97607856493873313e-01,
+    3.90380808237314580e-01, 3.83223811055901198e-01, 3.76135469510562592e-01, 3.69114453664472209e-01,
+    3.62159495369317574e-01, 3.55269384847917091e-01, 3.48442967546326587e-01, 3.41679141231550410e-01,
+    3.34976853313589173e-01, 3.28335098372850298e-01, 3.21752915875984924e-01, 3.15229388065010885e-01,
+    3.08763638006181118e-01, 3.02354827786483538e-01, 2.96002156846932984e-01, 2.89704860442959844e-01,
+    2.83462208223232981e-01, 2.77273502919188120e-01, 2.71138079138384613e-01, 2.65055302255589209e-01,
+    2.59024567396204830e-01, 2.53045298507325767e-01, 2.47116947512321411e-01, 2.41238993545439817e-01,
+    2.35410942263479084e-01, 2.29632325232116130e-01, 2.23902699385008425e-01, 2.18221646554305398e-01,
+    2.12588773071730297e-01, 2.07003709439926520e-01, 2.01466110074313670e-01, 1.95975653116277737e-01,
+    1.90532040319137147e-01, 1.85134997008992191e-01, 1.79784272123295452e-01, 1.74479638330789499e-01,
+    1.69220892237365000e-01, 1.64007854683420384e-01, 1.58840371139479297e-01, 1.53718312208181662e-01,
+    1.48641574242342256e-01, 1.43610080090627756e-01, 1.38623779984594603e-01, 1.33682652583439365e-01,
+    1.28786706195943207e-01, 1.23935980202867821e-01, 1.19130546707650831e-01, 1.14370512448866007e-01,
+    1.09656021014840274e-01, 1.04987255409421318e-01, 1.00364441028655868e-01, 9.57878491217314387e-02,
+    9.12578008268302571e-02, 8.67746718947801782e-02, 8.23388982422356558e-02, 7.79509825139733936e-02,
+    7.36115018841134033e-02, 6.93211173935779079e-02, 6.50805852130680734e-02, 6.08907703480404058e-02,
+    5.67526634810498476e-02, 5.26674019030510115e-02, 4.86362958598678050e-02, 4.46608622004914246e-02,
+    4.07428680744441746e-02, 3.68843887866562026e-02, 3.30878861462257506e-02, 2.93563174400068502e-02,
+    2.56932919359342711e-02, 2.21033046159270982e-02, 1.85921027370112880e-02, 1.51672980105465680e-02,
+    1.18394786578848617e-02, 8.62448441285988514e-03, 5.54899522077134492e-03, 2.66962908388092279e-03,
+};
+
+stat_zig_layer_t stat_ziggurat_layer(stat_size_t layer) {
+    assert(layer < PRIVATE_ZIG_LAYERS && "Ziggurat layer out of range");
+
+    stat_zig_layer_t out;
+    out.x = private_zig_w[layer] * 16777216.0; // undo the 2^24 magnitude scaling
+    out.f = private_zig_f[layer];
+    out.k = private_zig_k[layer];
+    return out;
+}
+
+// Wedge and tail fallback - reached by ~1.2% of draws
+static stat_float_t private_zig_slow(private_bits_pool_t* pool, uint32_t u) {
+    for (;;) {
+        const uint32_t layer = u & (PRIVATE_ZIG_LAYERS - 1);
+        const bool negative = (u & PRIVATE_ZIG_LAYERS) != 0;
+        const uint32_t j = u >> 8;
+        stat_float_t x = j * private_zig_w[layer];
+
+        if (j < private_zig_k[layer]) {
+            return negative ? -x : x;
+        }
+
+        if (layer == 0) {
+            // Tail beyond R (Marsaglia 1964)
+            stat_float_t y;
+            do {
+                x = -log(1.0 - private_bits_next(pool) * PRIVATE_INV_2POW32) / PRIVATE_ZIG_R;
+                y = -log(1.0 - private_bits_next(pool) * PRIVATE_INV_2POW32);
+            } while (y + y < x * x);
+            return negative ? -(PRIVATE_ZIG_R + x) : PRIVATE_ZIG_R + x;
+        }
+
+        const stat_float_t f0 = private_zig_f[layer];
+        if (f0 + private_bits_next(pool) * PRIVATE_INV_2POW32 * (private_zig_f[layer - 1] - f0) < exp(-0.5 * x * x)) {
+            return negative ? -x : x;
+        }
+        u = private_bits_next(pool);
+    }
+}
+
+static stat_float_t private_zig_normal(private_bits_pool_t* pool) {
+    const uint32_t u = private_bits_next(pool);
+    const uint32_t layer = u & (PRIVATE_ZIG_LAYERS - 1);
+    const uint32_t j = u >> 8;
+
+    if (j < private_zig_k[layer]) {
+        const stat_float_t x = j * private_zig_w[layer];
+        return (u & PRIVATE_ZIG_LAYERS) ? -x : x;
+    }
+    return private_zig_slow(pool, u);
+}
+
+void stat_generate_normal_dist_ex(
+    stat_float_t* output,
+    stat_size_t size,
+    stat_float_t mean, stat_float_t std_dev,
+    stat_normal_method_t method,
+    prng_state_t* state
+) {
+    assert(output != NULL && "Output array cannot be NULL");
+    assert(state != NULL && "PRNG state cannot be NULL");
+
+    if (size == 0 || std_dev < 0) {
+        errno = EINVAL;
+        return;
+    }
+
+    switch (method) {
+        case STAT_NORMAL_BOX_MULLER:
+            stat_generate_normal_dist(output, size, mean, std_dev, state);
+            break;
+
+        case STAT_NORMAL_POLAR: {
+            private_pool_t pool;
+            private_pool_init(&pool, state);
+            for (stat_size_t i = 0; i < size; i += 2) {
+                stat_float_t u, v, s;
+                do {
+                    u = 2.0 * private_pool_next(&pool) - 1.0;
+                    v = 2.0 * private_pool_next(&pool) - 1.0;
+                    s = u * u + v * v;
+                } while (s >= 1.0 || s == 0.0);
+
+                const stat_float_t mag = std_dev * sqrt(-2.0 * log(s) / s);
+                output[i] = u * mag + mean;
+                if (i + 1 < size) output[i+1] = v * mag + mean;
+            }
+            break;
+        }
+
+        case STAT_NORMAL_ZIGGURAT: {
+            private_bits_pool_t pool;
+            private_bits_init(&pool, state);
+            for (stat_size_t i = 0; i < size; i++) {
+                output[i] = private_zig_normal(&pool) * std_dev + mean;
+            }
+            break;
+        }
+
+        default:
+            assert(false && "Invalid normal sampling method");
+    }
+}
+
 void stat_generate_exponential_dist(
     stat_float_t* output,
     stat_size_t size,
@@ -71,9 +334,43 @@ void stat_generate_exponential_dist(
         return;
     }
 
+    prng_fill_double(state, output, size);
     for (stat_size_t i = 0; i < size; i++) {
-        const stat_float_t u = prng_next_float(state);
-        output[i] = -log(1.0f - u) / lambda;
+        output[i] = -log(1.0f - output[i]) / lambda;
+    }
+}
+
+// Hormann (1993) PTRS - transformed rejection with squeeze, lambda >= 10
+static void private_poisson_ptrs(stat_size_t* output, stat_size_t size, stat_float_t lambda, prng_state_t* state) {
+    const stat_float_t slam = sqrt(lambda);
+    const stat_float_t loglam = log(lambda);
+    const stat_float_t b = 0.931 + 2.53 * slam;
+    const stat_float_t a = -0.059 + 0.02483 * b;
+    const stat_float_t log_invalpha = log(1.1239 + 1.1328 / (b - 3.4));
+    const stat_float_t vr = 0.9277 - 3.6224 / (b - 2.0);
+
+    private_pool_t pool;
+    private_pool_init(&pool, state);
+    for (stat_size_t i = 0; i < size; i++) {
+        for (;;) {
+            const stat_float_t u = private_pool_next(&pool) - 0.5;
+            const stat_float_t v = 1.0 - private_pool_next(&pool); // (0, 1]
+            const stat_float_t us = 0.5 - fabs(u);
+            const stat_float_t k = floor((2.0 * a / us + b) * u + lambda + 0.43);
+
+            // Squeeze: ~89% of pairs accept without a log
+            if (us >= 0.07 && v <= vr) {
+                output[i] = (stat_size_t)k;
+                break;
+            }
+            if (k < 0.0 || (us < 0.013 && v > us)) {
+                continue;
+            }
+            if (log(v) + log_invalpha - log(a / (us * us) + b) <= -lambda + k * loglam - lgamma(k + 1.0)) {
+                output[i] = (stat_size_t)k;
+                break;
+            }
+        }
     }
 }
 
@@ -91,14 +388,21 @@ void stat_generate_poisson_dist(
         return;
     }
 
+    if (lambda >= STAT_POISSON_PTRS_MIN) {
+        private_poisson_ptrs(output, size, lambda, state);
+        return;
+    }
+
     const stat_float_t exp_lambda = exp(-lambda);
 
+    private_pool_t pool;
+    private_pool_init(&pool, state);
     for (stat_size_t i = 0; i < size; i++) {
         stat_size_t k = 0;
         stat_float_t p = 1.0f;
 
         do {
-            p *= prng_next_float(state);
+            p *= private_pool_next(&pool);
             k++;
         } while (p > exp_lambda);
 
@@ -106,6 +410,147 @@ void stat_generate_poisson_dist(
     }
 }
 
+// Sequential CDF search from 0, for n*r < STAT_BINOMIAL_BTPE_MIN (r <= 0.5)
+static void private_binomial_inversion(stat_size_t* output, stat_size_t size, stat_size_t n, stat_float_t r, prng_state_t* state) {
+    const stat_float_t q = 1.0 - r;
+    const stat_float_t q_n = exp(n * log(q));
+    const stat_float_t np = n * r;
+    const stat_float_t bound_f = np + 10.0 * sqrt(np * q + 1.0);
+    const stat_size_t bound = bound_f < n ? (stat_size_t)bound_f : n;
+
+    private_pool_t pool;
+    private_pool_init(&pool, state);
+    for (stat_size_t i = 0; i < size; i++) {
+        stat_size_t x = 0;
+        stat_float_t px = q_n;
+        stat_float_t u = private_pool_next(&pool);
+
+        while (u > px) {
+            x++;
+            if (x > bound) { // round-off ran past the mass - restart
+                x = 0;
+                px = q_n;
+                u = private_pool_next(&pool);
+            } else {
+                u -= px;
+                px = ((stat_float_t)(n - x + 1) * r * px) / (x * q);
+            }
+        }
+        output[i] = x;
+    }
+}
+
+/* Kachitvichyanukul & Schmeiser (1988) BTPE constants for r <= 0.5 */
+typedef struct {
+    stat_float_t n, r, q, nrq;
+    stat_float_t m, xm, xl, xr, c;
+    stat_float_t lambda_l, lambda_r;
+    stat_float_t p1, p2, p3, p4;
+} private_btpe_t;
+
+static void private_btpe_init(private_btpe_t* bt, stat_size_t n, stat_float_t r) {
+    bt->n = n;
+    bt->r = r;
+    bt->q = 1.0 - r;
+    bt->nrq = n * r * bt->q;
+
+    const stat_float_t fm = n * r + r;
+    bt->m = floor(fm);
+    bt->p1 = floor(2.195 * sqrt(bt->nrq) - 4.6 * bt->q) + 0.5;
+    bt->xm = bt->m + 0.5;
+    bt->xl = bt->xm - bt->p1;
+    bt->xr = bt->xm + bt->p1;
+    bt->c = 0.134 + 20.5 / (15.3 + bt->m);
+
+    stat_float_t a = (fm - bt->xl) / (fm - bt->xl * r);
+    bt->lambda_l = a * (1.0 + a / 2.0);
+    a = (bt->xr - fm) / (bt->xr * bt->q);
+    bt->lambda_r = a * (1.0 + a / 2.0);
+
+    bt->p2 = bt->p1 * (1.0 + 2.0 * bt->c);
+    bt->p3 = bt->p2 + bt->c / bt->lambda_l;
+    bt->p4 = bt->p3 + bt->c / bt->lambda_r;
+}
+
+// Stirling-series correction term used by the final BTPE test
+static stat_float_t private_btpe_stirling(stat_float_t x) {
+    const stat_float_t x2 = x * x;
+    return (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / x2) / x2) / x2) / x2) / x / 166320.0;
+}
+
+// Accepts candidate y with scaled height v against the binomial pmf ratio f(y)/f(m)
+static bool private_btpe_accept(const private_btpe_t* bt, stat_float_t y, stat_float_t v) {
+    const stat_float_t k = fabs(y - bt->m);
+
+    // Close to the mode: evaluate f(y)/f(m) by the recurrence
+    if (k <= 20.0 || k >= bt->nrq / 2.0 - 1.0) {
+        const stat_float_t s = bt->r / bt->q;
+        const stat_float_t a = s * (bt->n + 1.0);
+        stat_float_t f = 1.0;
+        if (bt->m < y) {
+            for (stat_float_t i = bt->m + 1.0; i <= y; i += 1.0) f *= (a / i - s);
+        } else if (bt->m > y) {
+            for (stat_float_t i = y + 1.0; i <= bt->m; i += 1.0) f /= (a / i - s);
+        }
+        return v <= f;
+    }
+
+    // Far from the mode: squeeze on log(v), then Stirling-based bound
+    const stat_float_t rho = (k / bt->nrq) * ((k * (k / 3.0 + 0.625) + 0.1666666666666) / bt->nrq + 0.5);
+    const stat_float_t t = -k * k / (2.0 * bt->nrq);
+    const stat_float_t log_v = log(v);
+    if (log_v < t - rho) return true;
+    if (log_v > t + rho) return false;
+
+    const stat_float_t x1 = y + 1.0;
+    const stat_float_t f1 = bt->m + 1.0;
+    const stat_float_t z = bt->n + 1.0 - bt->m;
+    const stat_float_t w = bt->n - y + 1.0;
+    const stat_float_t bound = bt->xm * log(f1 / x1)
+                             + (bt->n - bt->m + 0.5) * log(z / w)
+                             + (y - bt->m) * log(w * bt->r / (x1 * bt->q))
+                             + private_btpe_stirling(f1) + private_btpe_stirling(z)
+                             + private_btpe_stirling(x1) + private_btpe_stirling(w);
+    return log_v <= bound;
+}
+
+static stat_size_t private_btpe_next(const private_btpe_t* bt, private_pool_t* pool) {
+    for (;;) {
+        const stat_float_t u = private_pool_next(pool) * bt->p4;
+        stat_float_t v = private_pool_next(pool);
+        stat_float_t y;
+
+        if (u <= bt->p1) {
+            // Triangle: accepted outright
+            return (stat_size_t)floor(bt->xm - bt->p1 * v + u);
+        }
+
+        if (u <= bt->p2) {
+            // Parallelogram
+            const stat_float_t x = bt->xl + (u - bt->p1) / bt->c;
+            v = v * bt->c + 1.0 - fabs(bt->m - x + 0.5) / bt->p1;
+            if (v > 1.0) continue;
+            y = floor(x);
+        } else if (u <= bt->p3) {
+            // Left exponential tail
+            if (v == 0.0) continue;
+            y = floor(bt->xl + log(v) / bt->lambda_l);
+            if (y < 0.0) continue;
+            v = v * (u - bt->p2) * bt->lambda_l;
+        } else {
+            // Right exponential tail
+            if (v == 0.0) continue;
+            y = floor(bt->xr - log(v) / bt->lambda_r);
+            if (y > bt->n) continue;
+            v = v * (u - bt->p3) * bt->lambda_r;
+        }
+
+        if (private_btpe_accept(bt, y, v)) {
+            return (stat_size_t)y;
+        }
+    }
+}
+
 void stat_generate_binomial_dist(
     stat_size_t* output,
     stat_size_t size,
@@ -121,11 +566,22 @@ void stat_generate_binomial_dist(
         return;
     }
 
-    for (stat_size_t i = 0; i < size; i++) {
-        stat_size_t successes = 0;
-        for (stat_size_t j = 0; j < n; j++) {
-            if (prng_next_float(state) < p) successes++;
+    const stat_float_t r = p <= 0.5 ? p : 1.0 - p;
+    if (n * r < STAT_BINOMIAL_BTPE_MIN) {
+        private_binomial_inversion(output, size, n, r, state);
+    } else {
+        private_btpe_t bt;
+        private_pool_t pool;
+        private_btpe_init(&bt, n, r);
+        private_pool_init(&pool, state);
+        for (stat_size_t i = 0; i < size; i++) {
+            output[i] = private_btpe_next(&bt, &pool);
+        }
+    }
+
+    if (p > 0.5) {
+        for (stat_size_t i = 0; i < size; i++) {
+            output[i] = n - output[i];
         }
-        output[i] = successes;
     }
 }
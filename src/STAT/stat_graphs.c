@@ -38,3 +38,40 @@ void stat_graph_smooth_histogram(const stat_size_t* bins, const stat_binning_con
         printf(" %zu\n", bins[i]);
     }
 }
+
+void stat_graph_heatmap(const stat_size_t* counts, const stat_binning_config_t* x_axis, const stat_binning_config_t* y_axis, bool show_bin_info) {
+    static const unsigned char SHADES[] = {
+        CP437_SPACE, CP437_LIGHT_SHADE, CP437_MEDIUM_SHADE, CP437_DARK_SHADE, CP437_FULL_BLOCK
+    };
+    const stat_size_t levels = sizeof(SHADES) - 1;
+
+    assert(counts && "NULL counts!");
+    assert(x_axis && "NULL x axis!");
+    assert(y_axis && "NULL y axis!");
+
+    const stat_size_t cells = x_axis->count * y_axis->count;
+    stat_size_t max_count = 0;
+    for (stat_size_t i = 0; i < cells; i++) {
+        if (counts[i] > max_count) max_count = counts[i];
+    }
+
+    for (stat_size_t y = y_axis->count; y-- > 0; ) {
+        if (show_bin_info) {
+            printf("[%6.2f-%6.2f] ", y_axis->edges[y], y_axis->edges[y+1]);
+        } else {
+            printf("%3u ", (unsigned)y);
+        }
+
+        const stat_size_t* row = counts + y * x_axis->count;
+        for (stat_size_t x = 0; x < x_axis->count; x++) {
+            // Any non-zero cell gets at least the light shade
+            const stat_size_t level = max_count ? (row[x] * levels + max_count - 1) / max_count : 0;
+            printf("%c%c", SHADES[level], SHADES[level]);
+        }
+        printf("\n");
+    }
+
+    if (show_bin_info) {
+        printf("%16s%.2f - %.2f\n", "", x_axis->edges[0], x_axis->edges[x_axis->count]);
+    }
+}
@@ -26,4 +26,21 @@ void stat_graph_smooth_histogram(
     bool show_bin_info
 );
 
+/**
+ * @brief CP437 shaded-block heatmap of a row-major 2D count matrix
+ * @details Each cell is drawn two characters wide with one of five glyphs -
+ *          blank, light, medium and dark shade, full block - scaled to the
+ *          largest cell. The highest y row is printed first.
+ * @example
+ * [ 10.00- 20.00] ░░▒▒▓▓██
+ * [  0.00- 10.00] ▒▒██▓▓░░
+ *                 0.00 - 40.00
+ */
+void stat_graph_heatmap(
+    const stat_size_t* counts,
+    const stat_binning_config_t* x_axis,
+    const stat_binning_config_t* y_axis,
+    bool show_bin_info
+);
+
 #endif // STAT_GRAPHS_H
@@ -1,12 +1,20 @@
 #include "stat_percentiles.h"
 #include "stat_types.h"
 #include "stat_util.h"
+#include "stat_basic.h"
 #include <assert.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
+#ifdef STAT_CHECK_SORTED
+#define PRIVATE_ASSERT_SORTED(data, size) \
+    assert(stat_array_is_sorted_f(data, size) && "Data must be sorted in ascending order")
+#else
+#define PRIVATE_ASSERT_SORTED(data, size)
+#endif
+
 static stat_float_t private_compute_percentile_f(const stat_float_t* sorted, stat_size_t size, stat_float_t percentile) {
     assert(sorted != NULL);
     assert(size > 0);
@@ -20,6 +28,9 @@ static stat_float_t private_compute_percentile_f(const stat_float_t* sorted, sta
     const stat_size_t lower = (stat_size_t)rank;
     const stat_float_t frac = rank - lower;
 
+    if (lower >= size - 1) { // 100th percentile - no upper neighbour to interpolate with
+        return sorted[size - 1];
+    }
     return sorted[lower] + frac * (sorted[lower + 1] - sorted[lower]);
 }
 
@@ -41,7 +52,7 @@ stat_float_t stat_percentile_f(stat_float_t* data, stat_size_t size, stat_float_
     memcpy(sorted, data, size * sizeof(stat_float_t));
     stat_sort_f(sorted, size);
 
-    stat_float_t result = private_compute_percentile_f(sorted, size, percentile);
+    stat_float_t result = stat_percentile_sorted_f(sorted, size, percentile);
     free(sorted);
     return result;
 }
@@ -116,20 +127,7 @@ stat_five_num_summary_t stat_five_num_summary_f(stat_float_t* data, stat_size_t
     memcpy(sorted, data, size * sizeof(stat_float_t));
     stat_sort_f(sorted, size);
 
-    summary.min = sorted[0];
-    summary.q1 = private_compute_percentile_f(sorted, size, 25.0f);
-
-    if (size % 2 == 1) {
-        summary.median = sorted[size/2]; // For odd sizes, median can be direct access
-    } else {
-        summary.median = private_compute_percentile_f(sorted, size, 50.0f);
-    }
-
-    summary.q3 = private_compute_percentile_f(sorted, size, 75.0f);
-    summary.max = sorted[size - 1];
-    summary.iqr = summary.q3 - summary.q1;
-    summary.lower_fence = summary.q1 - 1.5f * summary.iqr;
-    summary.upper_fence = summary.q3 + 1.5f * summary.iqr;
+    summary = stat_five_num_summary_sorted_f(sorted, size);
 
     free(sorted);
     return summary;
@@ -148,9 +146,74 @@ static stat_float_t private_compute_percentile_i(const stat_int_t* sorted, stat_
     const stat_size_t lower = (stat_size_t)rank;
     const stat_float_t frac = rank - lower;
 
+    if (lower >= size - 1) {
+        return (stat_float_t)sorted[size - 1];
+    }
     return (stat_float_t)sorted[lower] + frac * (sorted[lower + 1] - sorted[lower]);
 }
 
+// Counting path: histogram of value offsets from min, walked by cumulative count.
+// The walker only moves forward, so ascending ranks cost O(n + span) in total.
+typedef struct {
+    const stat_size_t* counts;
+    stat_int_t min;
+    stat_size_t bin;  // current value offset
+    stat_size_t cum;  // number of elements with offset < bin
+} private_count_walker_t;
+
+// Returns true and fills min/span when the data range is small enough to count
+// (callers still fall back to sorting if the counts buffer cannot be allocated)
+static bool private_counting_eligible(const stat_int_t* data, stat_size_t size, stat_int_t* min, stat_size_t* span) {
+    *min = stat_min_int_array(data, size);
+    const int64_t range = (int64_t)stat_max_int_array(data, size) - *min;
+
+    if (range >= STAT_COUNTING_MAX_SPAN || (stat_size_t)range / 4 > size) {
+        return false; // too wide for the counts buffer, or sparse enough that sorting wins
+    }
+    *span = (stat_size_t)range + 1;
+    return true;
+}
+
+static stat_size_t* private_counting_histogram(const stat_int_t* data, stat_size_t size, stat_int_t min, stat_size_t span) {
+    stat_size_t* counts = calloc(span, sizeof(stat_size_t));
+    if (!counts) {
+        return NULL;
+    }
+    for (stat_size_t i = 0; i < size; i++) {
+        counts[(stat_size_t)(data[i] - min)]++;
+    }
+    return counts;
+}
+
+// Value at 0-based rank k (k must not decrease between calls)
+static stat_int_t private_walk_to_rank(private_count_walker_t* w, stat_size_t k) {
+    while (w->cum + w->counts[w->bin] <= k) {
+        w->cum += w->counts[w->bin++];
+    }
+    return w->min + (stat_int_t)w->bin;
+}
+
+static stat_float_t private_counting_percentile(private_count_walker_t* w, stat_size_t size, stat_float_t percentile) {
+    assert(percentile >= 0.0f && percentile <= 100.0f);
+
+    const stat_float_t rank = (percentile / 100.0f) * (size - 1);
+    const stat_size_t lower = (stat_size_t)rank;
+    const stat_float_t frac = rank - lower;
+    const stat_int_t lo = private_walk_to_rank(w, lower);
+
+    if (frac == 0 || lower + 1 >= size) {
+        return (stat_float_t)lo;
+    }
+
+    // Peek at rank lower+1 without advancing, so a repeated rank stays valid
+    stat_size_t bin = w->bin;
+    if (lower + 1 >= w->cum + w->counts[bin]) {
+        do { bin++; } while (w->counts[bin] == 0);
+    }
+    const stat_int_t hi = w->min + (stat_int_t)bin;
+    return (stat_float_t)lo + frac * (hi - lo);
+}
+
 stat_float_t stat_percentile_i(const stat_int_t* data, stat_size_t size, stat_float_t percentile) {
     assert(data != NULL && "Data pointer cannot be NULL");
     assert(size > 0 && "Data size cannot be 0");
@@ -160,6 +223,19 @@ stat_float_t stat_percentile_i(const stat_int_t* data, stat_size_t size, stat_fl
         return NAN;
     }
 
+    stat_int_t min;
+    stat_size_t span;
+    stat_size_t* counts = NULL;
+    if (private_counting_eligible(data, size, &min, &span)) {
+        counts = private_counting_histogram(data, size, min, span);
+    }
+    if (counts) {
+        private_count_walker_t walker = {counts, min, 0, 0};
+        stat_float_t result = private_counting_percentile(&walker, size, percentile);
+        free(counts);
+        return result;
+    }
+
     stat_int_t* sorted = malloc(size * sizeof(stat_int_t));
     if (!sorted) {
         errno = ENOMEM;
@@ -187,15 +263,8 @@ stat_float_t* stat_percentiles_array_i(
     assert(data_size > 0 && "Data size cannot be 0");
     assert(p_count && "Percentiles count cannot be 0");
 
-    stat_int_t* sorted = malloc(data_size * sizeof(stat_int_t));
-    if (!sorted) {
-        errno = ENOMEM;
-        return results;
-    }
-
     stat_float_t* sorted_percentiles = malloc(p_count * sizeof(stat_float_t));
     if (!sorted_percentiles) {
-        free(sorted);
         errno = ENOMEM;
         return results;
     }
@@ -203,19 +272,41 @@ stat_float_t* stat_percentiles_array_i(
     memcpy(sorted_percentiles, percentiles, p_count * sizeof(stat_float_t));
     stat_sort_f(sorted_percentiles, p_count);
 
-    memcpy(sorted, data, data_size * sizeof(stat_int_t));
-    stat_sort_i(sorted, data_size);
+    stat_int_t min;
+    stat_size_t span;
+    stat_size_t* counts = NULL;
+    stat_int_t* sorted = NULL;
 
+    if (private_counting_eligible(data, data_size, &min, &span)) {
+        counts = private_counting_histogram(data, data_size, min, span);
+    }
+    if (!counts) {
+        sorted = malloc(data_size * sizeof(stat_int_t));
+        if (sorted) {
+            memcpy(sorted, data, data_size * sizeof(stat_int_t));
+            stat_sort_i(sorted, data_size);
+        }
+    }
+    if (!counts && !sorted) {
+        free(sorted_percentiles);
+        errno = ENOMEM;
+        return results;
+    }
+
+    private_count_walker_t walker = {counts, min, 0, 0};
     for (stat_size_t i = 0; i < p_count; i++) {
         if (sorted_percentiles[i] < 0 || sorted_percentiles[i] > 100) {
             results[i] = NAN;
             errno = EDOM;
             break;
+        } else if (counts) {
+            results[i] = private_counting_percentile(&walker, data_size, sorted_percentiles[i]);
         } else {
             results[i] = private_compute_percentile_i(sorted, data_size, sorted_percentiles[i]);
         }
     }
 
+    free(counts);
     free(sorted);
     free(sorted_percentiles);
     return results;
@@ -244,30 +335,170 @@ stat_five_num_summary_t stat_five_num_summary_i(const stat_int_t* data, stat_siz
         return summary;
     }
 
-    stat_int_t* sorted = malloc(size * sizeof(stat_int_t));
-    if (!sorted) {
-        errno = ENOMEM;
-        return summary;
+    stat_int_t min;
+    stat_size_t span;
+    stat_size_t* counts = NULL;
+    if (private_counting_eligible(data, size, &min, &span)) {
+        counts = private_counting_histogram(data, size, min, span);
     }
+    if (counts) {
+        private_count_walker_t walker = {counts, min, 0, 0};
+        summary.min = (stat_float_t)min;
+        summary.q1 = private_counting_percentile(&walker, size, 25.0f);
+        summary.median = private_counting_percentile(&walker, size, 50.0f);
+        summary.q3 = private_counting_percentile(&walker, size, 75.0f);
+        summary.max = (stat_float_t)(min + (stat_int_t)(span - 1));
+        free(counts);
+    } else {
+        stat_int_t* sorted = malloc(size * sizeof(stat_int_t));
+        if (!sorted) {
+            errno = ENOMEM;
+            return summary;
+        }
 
-    memcpy(sorted, data, size * sizeof(stat_int_t));
-    stat_sort_i(sorted, size);
+        memcpy(sorted, data, size * sizeof(stat_int_t));
+        stat_sort_i(sorted, size);
+
+        summary.min = (stat_float_t)sorted[0];
+        summary.q1 = private_compute_percentile_i(sorted, size, 25.0f);
+
+        if (size % 2 == 1) {
+            summary.median = (stat_float_t)sorted[size >> 1];
+        } else {
+            summary.median = private_compute_percentile_i(sorted, size, 50.0f);
+        }
+
+        summary.q3 = private_compute_percentile_i(sorted, size, 75.0f);
+        summary.max = (stat_float_t)sorted[size - 1];
+        free(sorted);
+    }
+
+    summary.iqr = summary.q3 - summary.q1;
+    summary.lower_fence = summary.q1 - 1.5f * summary.iqr;
+    summary.upper_fence = summary.q3 + 1.5f * summary.iqr;
+    return summary;
+}
+
+// ======================== SORTED (ZERO-COPY) VERSIONS ========================
+
+stat_float_t stat_percentile_sorted_f(const stat_float_t* sorted, stat_size_t size, stat_float_t percentile) {
+    assert(sorted != NULL && "Data pointer cannot be NULL");
+    assert(size > 0 && "Data size cannot be 0");
+    PRIVATE_ASSERT_SORTED(sorted, size);
+
+    if (size == 0 || percentile < 0 || percentile > 100) {
+        errno = EDOM;
+        return NAN;
+    }
+
+    return private_compute_percentile_f(sorted, size, percentile);
+}
 
-    summary.min = (stat_float_t)sorted[0];
-    summary.q1 = private_compute_percentile_i(sorted, size, 25.0f);
+stat_float_t* stat_percentiles_sorted_f(
+    const stat_float_t* sorted,
+    stat_size_t data_size,
+    const stat_float_t* percentiles,
+    stat_float_t* results,
+    stat_size_t p_count
+) {
+    assert(sorted != NULL && "Data pointer cannot be NULL");
+    assert(percentiles != NULL && "Percentiles pointer cannot be NULL");
+    assert(results != NULL && "Results pointer cannot be NULL");
+    assert(data_size > 0 && "Data size cannot be 0");
+    PRIVATE_ASSERT_SORTED(sorted, data_size);
+
+    for (stat_size_t i = 0; i < p_count; i++) {
+        if (data_size == 0 || percentiles[i] < 0 || percentiles[i] > 100) {
+            results[i] = NAN;
+            errno = EDOM;
+        } else {
+            results[i] = private_compute_percentile_f(sorted, data_size, percentiles[i]);
+        }
+    }
+    return results;
+}
+
+stat_five_num_summary_t stat_five_num_summary_sorted_f(const stat_float_t* sorted, stat_size_t size) {
+    assert(sorted != NULL && "Data pointer cannot be NULL");
+    assert(size > 0 && "Data size cannot be 0");
+    PRIVATE_ASSERT_SORTED(sorted, size);
+
+    stat_five_num_summary_t summary = {0};
+    if (size == 0) {
+        errno = EDOM;
+        return summary;
+    }
+
+    summary.min = sorted[0];
+    summary.q1 = private_compute_percentile_f(sorted, size, 25.0f);
 
     if (size % 2 == 1) {
-        summary.median = (stat_float_t)sorted[size >> 1];
+        summary.median = sorted[size/2]; // For odd sizes, median can be direct access
     } else {
-        summary.median = private_compute_percentile_i(sorted, size, 50.0f);
+        summary.median = private_compute_percentile_f(sorted, size, 50.0f);
     }
 
-    summary.q3 = private_compute_percentile_i(sorted, size, 75.0f);
-    summary.max = (stat_float_t)sorted[size - 1];
+    summary.q3 = private_compute_percentile_f(sorted, size, 75.0f);
+    summary.max = sorted[size - 1];
     summary.iqr = summary.q3 - summary.q1;
     summary.lower_fence = summary.q1 - 1.5f * summary.iqr;
     summary.upper_fence = summary.q3 + 1.5f * summary.iqr;
 
-    free(sorted);
     return summary;
 }
+
+stat_float_t stat_median_sorted_f(const stat_float_t* sorted, stat_size_t size) {
+    assert(sorted != NULL && "Data pointer cannot be NULL");
+    assert(size > 0 && "Data size cannot be 0");
+    PRIVATE_ASSERT_SORTED(sorted, size);
+
+    if (size == 0) {
+        errno = EDOM;
+        return NAN;
+    }
+
+    if (size % 2 == 1) {
+        return sorted[size / 2];
+    }
+    return (sorted[size/2 - 1] + sorted[size/2]) / 2.0f;
+}
+
+stat_float_t stat_iqr_sorted_f(const stat_float_t* sorted, stat_size_t size) {
+    assert(sorted != NULL && "Data pointer cannot be NULL");
+    assert(size > 0 && "Data size cannot be 0");
+    PRIVATE_ASSERT_SORTED(sorted, size);
+
+    if (size == 0) {
+        errno = EDOM;
+        return NAN;
+    }
+
+    return private_compute_percentile_f(sorted, size, 75.0f)
+         - private_compute_percentile_f(sorted, size, 25.0f);
+}
+
+stat_float_t stat_percentile_select_f(stat_float_t* workspace, stat_size_t size, stat_float_t percentile) {
+    assert(workspace != NULL && "Workspace pointer cannot be NULL");
+    assert(size > 0 && "Data size cannot be 0");
+
+    if (percentile < 0.0f || percentile > 100.0f) {
+        errno = EDOM;
+        return NAN;
+    }
+
+    const stat_float_t rank = (percentile / 100.0f) * (size - 1);
+    const stat_size_t lower = (stat_size_t)rank;
+    const stat_float_t frac = rank - lower;
+    const stat_float_t value = stat_select_f(workspace, size, lower);
+
+    if (lower >= size - 1 || frac == 0.0) {
+        return value;
+    }
+
+    // Everything right of the selected rank is >= it; its minimum is rank lower+1
+    stat_float_t next = workspace[lower + 1];
+    for (stat_size_t i = lower + 2; i < size; i++) {
+        next = workspace[i] < next ? workspace[i] : next;
+    }
+    return value + frac * (next - value);
+}
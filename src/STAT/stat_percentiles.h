@@ -85,13 +85,31 @@ stat_five_num_summary_t stat_five_num_summary_f(
 );
 
 // ======================== INTEGER VERSIONS ========================
+/*
+ * When the data span (max - min + 1) is at most STAT_COUNTING_MAX_SPAN and not
+ * much wider than the sample count (typical of 8-14 bit ADC data) the integer
+ * percentile functions build a counting histogram and walk its prefix sums
+ * instead of sorting a copy: exact results in O(n + range). Otherwise, or if
+ * the counts buffer cannot be allocated, they fall back to copy-and-sort.
+ * Selection is automatic.
+ *
+ * Range limitation: one stat_size_t count per value must fit a single 64KB
+ * segment, so full-scale 16-bit data (65536 values) always takes the sort path.
+ */
+
+/** Widest value span handled by counting (16383 * 4-byte counts = 65532 bytes) */
+#ifndef STAT_COUNTING_MAX_SPAN
+#define STAT_COUNTING_MAX_SPAN 16383L
+#endif
+
 /**
  * @brief Compute a percentile for integer data.
  * @param[in] data Input array of integers. Will be copied and sorted internally.
  * @param[in] size Number of elements in the array. Must be > 0.
  * @param[in] percentile The desired percentile (0.0 to 100.0).
  * @return Computed percentile as float (for interpolation).
- * @details Creates an internal sorted copy of the data (original remains unchanged).
+ * @details Uses the counting path for narrow ranges, otherwise creates an
+ *          internal sorted copy of the data (original remains unchanged).
  */
 stat_float_t stat_percentile_i(
     const stat_int_t* data,
@@ -107,7 +125,8 @@ stat_float_t stat_percentile_i(
  * @param[out] results Pre-allocated output buffer for results.
  * @param[in] p_count Number of percentiles to compute.
  * @return Pointer to results array.
- * @details Creates an internal sorted copy of the data (original remains unchanged).
+ * @details Uses the counting path for narrow ranges (one walk for all percentiles),
+ *          otherwise creates an internal sorted copy (original remains unchanged).
  */
 stat_float_t* stat_percentiles_array_i(
     const stat_int_t* data,
@@ -136,11 +155,109 @@ stat_float_t stat_quartile_i(
  * @param[in] data Input array of integers. Will be copied and sorted internally.
  * @param[in] size Number of elements in the array. Must be > 0.
  * @return Struct containing five-number summary with Tukey's fences.
- * @details Creates an internal sorted copy of the data (original remains unchanged).
+ * @details Uses the counting path for narrow ranges, otherwise creates an
+ *          internal sorted copy of the data (original remains unchanged).
  */
 stat_five_num_summary_t stat_five_num_summary_i(
     const stat_int_t* data,
     stat_size_t size
 );
 
+// ======================== SORTED (ZERO-COPY) VERSIONS ========================
+/*
+ * The *_sorted_f family works directly on caller-owned data that is already in
+ * ascending order: no copy, no sort, no allocation. Each quantile costs O(1).
+ * Define STAT_CHECK_SORTED to have every entry point assert the ordering with
+ * stat_array_is_sorted_f() (O(n), debug builds only).
+ */
+
+/**
+ * @brief Compute a single percentile from data already sorted in ascending order.
+ * @param[in] sorted Pointer to the sorted input array. Must not be NULL.
+ * @param[in] size Number of elements in the array. Must be > 0.
+ * @param[in] percentile The desired percentile (0.0 to 100.0).
+ * @return The computed percentile value, or NAN with errno=EDOM if out of range.
+ * @note Same linear interpolation as stat_percentile_f().
+ * @details Zero-copy O(1) lookup - the input is neither copied nor modified.
+ */
+stat_float_t stat_percentile_sorted_f(
+    const stat_float_t* sorted,
+    stat_size_t size,
+    stat_float_t percentile
+);
+
+/**
+ * @brief Compute multiple percentiles from data already sorted in ascending order.
+ * @param[in] sorted      Pointer to the sorted input array. Must not be NULL.
+ * @param[in] data_size   Number of elements in the array. Must be > 0.
+ * @param[in] percentiles Array of desired percentiles (0.0 to 100.0 each), in any order.
+ *                        Not modified.
+ * @param[out] results    Pre-allocated array with at least p_count elements.
+ *                        results[i] corresponds to percentiles[i].
+ * @param[in] p_count     Number of percentiles to compute.
+ * @return Pointer to the results array (same as input results parameter).
+ * @details Zero-copy O(p_count) - out of range percentiles yield NAN and set errno=EDOM.
+ */
+stat_float_t* stat_percentiles_sorted_f(
+    const stat_float_t* sorted,
+    stat_size_t data_size,
+    const stat_float_t* percentiles,
+    stat_float_t* results,
+    stat_size_t p_count
+);
+
+/**
+ * @brief Compute the five-number summary from data already sorted in ascending order.
+ * @param[in] sorted Pointer to the sorted input array. Must not be NULL.
+ * @param[in] size Number of elements in the array. Must be > 0.
+ * @return Struct containing the same fields as stat_five_num_summary_f().
+ * @details Zero-copy O(1) - min and max are read from the ends of the array.
+ */
+stat_five_num_summary_t stat_five_num_summary_sorted_f(
+    const stat_float_t* sorted,
+    stat_size_t size
+);
+
+/**
+ * @brief Compute the median of data already sorted in ascending order.
+ * @param[in] sorted Pointer to the sorted input array. Must not be NULL.
+ * @param[in] size Number of elements in the array. Must be > 0.
+ * @return Median value (mean of the two middle values for even sizes),
+ *         or NAN with errno=EDOM for size=0.
+ * @details Zero-copy O(1).
+ */
+stat_float_t stat_median_sorted_f(
+    const stat_float_t* sorted,
+    stat_size_t size
+);
+
+/**
+ * @brief Compute the Interquartile Range (Q3 - Q1) of data already sorted in ascending order.
+ * @param[in] sorted Pointer to the sorted input array. Must not be NULL.
+ * @param[in] size Number of elements in the array. Must be > 0.
+ * @return IQR as stat_float_t, or NAN with errno=EDOM for size=0.
+ * @details Zero-copy O(1).
+ */
+stat_float_t stat_iqr_sorted_f(
+    const stat_float_t* sorted,
+    stat_size_t size
+);
+
+/**
+ * @brief Compute a percentile by selection instead of sorting.
+ * @param[in,out] workspace Caller scratch copy of the data (partially reordered). Must not be NULL.
+ * @param[in] size Number of elements in the array. Must be > 0.
+ * @param[in] percentile Desired percentile (0.0 to 100.0).
+ * @return Same interpolated value as stat_percentile_f(), or NAN with errno=EDOM
+ *         for an out of range percentile.
+ * @details O(n) average via stat_select_f(). Several percentiles can be taken
+ *          from the same workspace; each call selects over the whole array.
+ * @warning Workspace must not contain NaN.
+ */
+stat_float_t stat_percentile_select_f(
+    stat_float_t* workspace,
+    stat_size_t size,
+    stat_float_t percentile
+);
+
 #endif // STAT_PERCENTILES_H
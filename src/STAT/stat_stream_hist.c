@@ -0,0 +1,190 @@
+#include "stat_stream_hist.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+// Folds the closest pair of adjacent centroids into their weighted mean
+static void private_merge_closest(stat_stream_hist_t* hist) {
+    stat_stream_bin_t* bins = hist->bins;
+    stat_size_t best = 0;
+    stat_float_t best_gap = bins[1].center - bins[0].center;
+
+    for (stat_size_t i = 1; i + 1 < hist->count; i++) {
+        const stat_float_t gap = bins[i + 1].center - bins[i].center;
+        if (gap < best_gap) {
+            best_gap = gap;
+            best = i;
+        }
+    }
+
+    // Interpolated form keeps the new center between its two parents
+    const stat_size_t weight = bins[best].weight + bins[best + 1].weight;
+    bins[best].center += best_gap * ((stat_float_t)bins[best + 1].weight / weight);
+    bins[best].weight = weight;
+
+    memmove(&bins[best + 1], &bins[best + 2], (hist->count - best - 2) * sizeof(stat_stream_bin_t));
+    hist->count--;
+}
+
+static void private_insert(stat_stream_hist_t* hist, stat_float_t center, stat_size_t weight) {
+    stat_stream_bin_t* bins = hist->bins;
+
+    // First centroid with center >= the new one
+    stat_size_t lo = 0, hi = hist->count;
+    while (lo < hi) {
+        const stat_size_t mid = lo + (hi - lo) / 2;
+        if (bins[mid].center < center) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < hist->count && bins[lo].center == center) {
+        bins[lo].weight += weight;
+        return;
+    }
+
+    memmove(&bins[lo + 1], &bins[lo], (hist->count - lo) * sizeof(stat_stream_bin_t));
+    bins[lo].center = center;
+    bins[lo].weight = weight;
+    hist->count++;
+
+    if (hist->count > hist->max_bins) {
+        private_merge_closest(hist);
+    }
+}
+
+stat_stream_hist_t* stat_stream_hist_init(stat_stream_hist_t* hist, stat_stream_bin_t* storage, stat_size_t max_bins) {
+    assert(hist != NULL && "Histogram cannot be NULL");
+    assert(storage != NULL && "Storage cannot be NULL");
+    assert(max_bins >= 2 && "Need at least 2 bins");
+
+    hist->bins = storage;
+    hist->max_bins = max_bins;
+    hist->count = 0;
+    hist->total = 0;
+    hist->min = NAN;
+    hist->max = NAN;
+    return hist;
+}
+
+stat_stream_hist_t* stat_stream_hist_add_f(stat_stream_hist_t* hist, stat_float_t value) {
+    assert(hist != NULL && "Histogram cannot be NULL");
+
+    if (isnan(value)) {
+        errno = EDOM;
+        return hist;
+    }
+
+    if (hist->total == 0) {
+        hist->min = hist->max = value;
+    } else {
+        hist->min = value < hist->min ? value : hist->min;
+        hist->max = value > hist->max ? value : hist->max;
+    }
+    hist->total++;
+
+    private_insert(hist, value, 1);
+    return hist;
+}
+
+stat_stream_hist_t* stat_stream_hist_add_array_f(stat_stream_hist_t* hist, const stat_float_t* values, stat_size_t count) {
+    assert(values != NULL && "Input array cannot be NULL");
+
+    for (stat_size_t i = 0; i < count; i++) {
+        stat_stream_hist_add_f(hist, values[i]);
+    }
+    return hist;
+}
+
+stat_stream_hist_t* stat_stream_hist_merge(stat_stream_hist_t* dest, const stat_stream_hist_t* src) {
+    assert(dest != NULL && "Destination cannot be NULL");
+    assert(src != NULL && "Source cannot be NULL");
+    assert(dest != src && "Cannot merge a histogram into itself");
+
+    if (src->total == 0) {
+        return dest;
+    }
+
+    if (dest->total == 0) {
+        dest->min = src->min;
+        dest->max = src->max;
+    } else {
+        dest->min = src->min < dest->min ? src->min : dest->min;
+        dest->max = src->max > dest->max ? src->max : dest->max;
+    }
+    dest->total += src->total;
+
+    for (stat_size_t i = 0; i < src->count; i++) {
+        private_insert(dest, src->bins[i].center, src->bins[i].weight);
+    }
+    return dest;
+}
+
+stat_float_t stat_stream_hist_sum(const stat_stream_hist_t* hist, stat_float_t x) {
+    assert(hist != NULL && "Histogram cannot be NULL");
+
+    if (hist->total == 0 || x < hist->min) {
+        return 0.0;
+    }
+    if (x >= hist->max) {
+        return (stat_float_t)hist->total;
+    }
+
+    // Points are (min, 0), the centroids, then (max, 0); find p[i] <= x < p[i+1]
+    stat_float_t left_center = hist->min;
+    stat_float_t left_weight = 0.0;
+    stat_float_t sum = 0.0;
+    stat_size_t i = 0;
+    while (i < hist->count && hist->bins[i].center <= x) {
+        sum += left_weight;
+        left_center = hist->bins[i].center;
+        left_weight = (stat_float_t)hist->bins[i].weight;
+        i++;
+    }
+
+    const stat_float_t right_center = (i < hist->count) ? hist->bins[i].center : hist->max;
+    const stat_float_t right_weight = (i < hist->count) ? (stat_float_t)hist->bins[i].weight : 0.0;
+
+    // Half of the left centroid, plus the trapezoid from its center up to x
+    const stat_float_t frac = (x - left_center) / (right_center - left_center);
+    const stat_float_t weight_at_x = left_weight + (right_weight - left_weight) * frac;
+    return sum + left_weight / 2.0 + (left_weight + weight_at_x) / 2.0 * frac;
+}
+
+stat_size_t* stat_stream_hist_export(const stat_stream_hist_t* hist, stat_binning_config_t* config, stat_size_t* bins) {
+    assert(hist != NULL && "Histogram cannot be NULL");
+    assert(config != NULL && "Config cannot be NULL");
+    assert(bins != NULL && "Bins cannot be NULL");
+
+    if (hist->total == 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    config->min = hist->min;
+    config->max = hist->max;
+    if (config->min == config->max) {
+        config->min -= 0.5;
+        config->max += 0.5;
+    }
+    stat_binning_calculate_edges(config, BIN_LINEAR);
+
+    // Differences of the rounded cumulative estimate: never negative, sum to total
+    stat_size_t below = 0;
+    for (stat_size_t i = 0; i < config->count; i++) {
+        stat_size_t upto = hist->total;
+        if (i + 1 < config->count) {
+            const stat_float_t estimate = floor(stat_stream_hist_sum(hist, config->edges[i + 1]) + 0.5);
+            upto = (stat_size_t)estimate;
+            upto = upto < below ? below : upto;
+            upto = upto > hist->total ? hist->total : upto;
+        }
+        bins[i] = upto - below;
+        below = upto;
+    }
+    return bins;
+}
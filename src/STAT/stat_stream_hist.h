@@ -0,0 +1,107 @@
+#ifndef STAT_STREAM_HIST_H
+#define STAT_STREAM_HIST_H
+
+#include "stat_types.h"
+#include "stat_binning.h"
+
+/**
+ * @file stat_stream_hist.h
+ * @brief Streaming histogram with a bounded number of adaptive bins
+ *
+ * stat_auto_bin_f() needs the whole dataset up front. A stat_stream_hist_t
+ * (Ben-Haim & Tom-Tov) instead keeps at most max_bins (center, weight)
+ * centroids sorted by center: each new value becomes a centroid, and whenever
+ * the limit is exceeded the two closest adjacent centroids are merged into
+ * their weighted mean. Memory is fixed, every insert is O(max_bins), and two
+ * histograms built on different shards can be merged.
+ *
+ * @code
+ * stat_stream_bin_t storage[STAT_STREAM_HIST_STORAGE(64)];
+ * stat_stream_hist_t h;
+ * stat_stream_hist_init(&h, storage, 64);
+ * while (read_sample(&x)) stat_stream_hist_add_f(&h, x);
+ *
+ * stat_float_t edges[21];
+ * stat_size_t bins[20];
+ * stat_binning_config_t cfg = {0};
+ * cfg.count = 20;
+ * cfg.edges = edges;
+ * stat_stream_hist_export(&h, &cfg, bins);
+ * stat_graph_smooth_histogram(bins, &cfg, 10, true);
+ * @endcode
+ */
+
+/** One adaptive bin: a centroid and the number of values it represents */
+typedef struct {
+    stat_float_t center; ///< Mean of the values merged into this bin
+    stat_size_t weight;  ///< Number of values merged into this bin
+} stat_stream_bin_t;
+
+/** Storage elements needed for a histogram of max_bins (one spare slot for the pending merge) */
+#define STAT_STREAM_HIST_STORAGE(max_bins) ((max_bins) + 1)
+
+typedef struct {
+    stat_stream_bin_t* bins; ///< Caller storage, STAT_STREAM_HIST_STORAGE(max_bins) elements
+    stat_size_t max_bins;    ///< Centroid limit
+    stat_size_t count;       ///< Centroids in use, sorted by center
+    stat_size_t total;       ///< Values added (sum of all weights)
+    stat_float_t min;        ///< Smallest value seen (valid when total > 0)
+    stat_float_t max;        ///< Largest value seen (valid when total > 0)
+} stat_stream_hist_t;
+
+/**
+ * @brief Initializes an empty streaming histogram on caller storage
+ * @param[out] hist Histogram handle
+ * @param[in] storage Caller array of STAT_STREAM_HIST_STORAGE(max_bins) elements
+ * @param[in] max_bins Maximum number of centroids kept (>= 2)
+ * @return hist pointer for chaining
+ * @assert Fails if hist or storage is NULL, or max_bins < 2
+ */
+stat_stream_hist_t* stat_stream_hist_init(stat_stream_hist_t* hist, stat_stream_bin_t* storage, stat_size_t max_bins);
+
+/**
+ * @brief Adds one value, merging the closest centroids if the limit is exceeded
+ * @return hist pointer for chaining
+ * @throws EDOM if value is NaN (the value is ignored)
+ */
+stat_stream_hist_t* stat_stream_hist_add_f(stat_stream_hist_t* hist, stat_float_t value);
+
+/**
+ * @brief Adds an array of values
+ * @return hist pointer for chaining
+ * @throws EDOM if any value is NaN (NaNs are ignored)
+ */
+stat_stream_hist_t* stat_stream_hist_add_array_f(stat_stream_hist_t* hist, const stat_float_t* values, stat_size_t count);
+
+/**
+ * @brief Folds another histogram (e.g. a shard's) into dest
+ * @param[in,out] dest Histogram receiving the centroids (keeps its own max_bins)
+ * @param[in] src Histogram to merge, left unchanged
+ * @return dest pointer for chaining
+ */
+stat_stream_hist_t* stat_stream_hist_merge(stat_stream_hist_t* dest, const stat_stream_hist_t* src);
+
+/**
+ * @brief Estimated number of values <= x
+ * @details Interpolates the trapezoids between neighbouring centroids, with
+ *          zero-weight anchors at min and max so the estimate runs from 0 at
+ *          min to total at max.
+ * @return Estimated cumulative count (0 for an empty histogram)
+ */
+stat_float_t stat_stream_hist_sum(const stat_stream_hist_t* hist, stat_float_t x);
+
+/**
+ * @brief Exports the histogram as equal-width bins over [min, max]
+ * @param[in] hist Histogram to export
+ * @param[in,out] config count and edges (count+1 elements) set by the caller;
+ *                min, max, edges and strategy are filled in (BIN_LINEAR)
+ * @param[out] bins Caller array of config->count elements (overwritten)
+ * @return bins pointer for chaining, NULL if the histogram is empty
+ * @throws EINVAL if the histogram is empty
+ * @note Counts are rounded from stat_stream_hist_sum() at each edge and always
+ *       add up to hist->total. A single distinct value is exported over
+ *       [value - 0.5, value + 0.5].
+ */
+stat_size_t* stat_stream_hist_export(const stat_stream_hist_t* hist, stat_binning_config_t* config, stat_size_t* bins);
+
+#endif // STAT_STREAM_HIST_H
@@ -23,6 +23,7 @@ static void quicksort_f(stat_float_t* data, stat_size_t left, stat_size_t right)
             data[i] = data[j];
             data[j] = temp;
             i++;
+            if (j == 0) break; // unsigned index: nothing left of the pivot
             j--;
         }
     }
@@ -38,6 +39,40 @@ void stat_sort_f(stat_float_t* data, stat_size_t size) {
     }
 }
 
+stat_float_t stat_select_f(stat_float_t* data, stat_size_t size, stat_size_t k) {
+    assert(data != NULL);
+    assert(k < size && "Rank out of range");
+
+    stat_size_t left = 0, right = size - 1;
+    while (left < right) {
+        // Same partition as quicksort_f, but only the side holding k is kept
+        const stat_float_t pivot = data[left + (right - left) / 2];
+        stat_size_t i = left, j = right;
+
+        while (i <= j) {
+            while (data[i] < pivot) i++;
+            while (data[j] > pivot) j--;
+            if (i <= j) {
+                stat_float_t temp = data[i];
+                data[i] = data[j];
+                data[j] = temp;
+                i++;
+                if (j == 0) break;
+                j--;
+            }
+        }
+
+        if (k <= j) {
+            right = j;
+        } else if (k >= i) {
+            left = i;
+        } else {
+            break; // k sits in the run equal to the pivot
+        }
+    }
+    return data[k];
+}
+
 static void insertion_sort_i(stat_int_t* data, stat_size_t size) {
     for (stat_size_t i = 1; i < size; i++) {
         stat_int_t key = data[i];
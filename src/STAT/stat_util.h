@@ -35,6 +35,19 @@ void stat_sort_f(stat_float_t* data, stat_size_t size);
  */
 void stat_sort_i(stat_int_t* data, stat_size_t size);
 
+/**
+ * @brief Finds the k-th smallest value by partial reordering (quickselect)
+ * @param[in,out] data Scratch array (reordered in-place)
+ * @param[in] size Number of elements in the array
+ * @param[in] k Zero-based rank to select
+ * @return The value that would be data[k] after a full sort
+ * @note O(n) average. Afterwards data[0..k-1] <= data[k] <= data[k+1..size-1],
+ *       so selecting a larger rank next only has to look right of k.
+ * @warning Data must not contain NaN
+ * @assert data != NULL, k < size
+ */
+stat_float_t stat_select_f(stat_float_t* data, stat_size_t size, stat_size_t k);
+
 // ========================
 // Value Validation
 // ========================
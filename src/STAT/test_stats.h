@@ -3,10 +3,17 @@
 
 //#include "stat_IEEE754.h"
 #include "stat_abs.h"
+#include "stat_percentiles.h"
+#include "stat_dataset.h"
+#include "stat_binning.h"
+#include "stat_stream_hist.h"
+#include "stat_distributions.h"
+#include "stat_constants.h"
 #include "stat_types.h"
 #include "../TDD/tdd_macros.h"
 #include <math.h>
 #include <errno.h>
+#include <string.h>
 
 // =============================================
 // Test Suite Declaration
@@ -16,6 +23,26 @@
                        &test_abs_edge_cases, \
                        &test_abs_error_handling
 
+#define PERCENTILES_TEST_SUITE &test_percentiles_sorted, \
+                               &test_percentiles_counting_i
+
+#define DATASET_TEST_SUITE &test_dataset_cache
+
+#define BINNING_TEST_SUITE &test_binning_edges, \
+                           &test_binning_log2, \
+                           &test_binning_2d, \
+                           &test_stream_hist, \
+                           &test_binning_rules, \
+                           &test_binning_equal_frequency, \
+                           &test_binning_natural, \
+                           &test_binning_digitize_widths, \
+                           &test_binning_parallel
+
+#define DISTRIBUTIONS_TEST_SUITE &test_dist_ziggurat_tables, \
+                                 &test_dist_normal_methods, \
+                                 &test_dist_poisson, \
+                                 &test_dist_binomial
+
 //#define BASIC_TEST_SUITE &test_basic_scalar, \
                          &test_basic_array_operations, \
                          &test_basic_array_conversions, \
@@ -132,6 +159,465 @@ TEST(test_abs_error_handling) {
     EXPECT_EQ(errno, ERANGE);
 }
 
+// =============================================
+// PERCENTILES Test Cases
+// =============================================
+
+TEST(test_percentiles_sorted) {
+    const stat_float_t sorted[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    stat_float_t unsorted[] = {5.0, 1.0, 8.0, 3.0, 7.0, 2.0, 6.0, 4.0};
+    const stat_float_t centiles[] = {100.0, 0.0, 50.0};
+    stat_float_t results[3];
+
+    // Sorted variants agree with the copy-and-sort entry points
+    EXPECT_ALMOST_EQ(stat_percentile_sorted_f(sorted, 8, 25.0), stat_percentile_f(unsorted, 8, 25.0), 0.0001);
+    EXPECT_ALMOST_EQ(stat_median_sorted_f(sorted, 8), 4.5, 0.0001);
+    EXPECT_ALMOST_EQ(stat_median_sorted_f(sorted, 7), 4.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_iqr_sorted_f(sorted, 8), 3.5, 0.0001);
+
+    // Results follow the caller's percentile order and the 100th percentile is the max
+    stat_percentiles_sorted_f(sorted, 8, centiles, results, 3);
+    EXPECT_ALMOST_EQ(results[0], 8.0, 0.0001);
+    EXPECT_ALMOST_EQ(results[1], 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(results[2], 4.5, 0.0001);
+
+    stat_five_num_summary_t summary = stat_five_num_summary_sorted_f(sorted, 8);
+    EXPECT_ALMOST_EQ(summary.min, 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(summary.q1, 2.75, 0.0001);
+    EXPECT_ALMOST_EQ(summary.median, 4.5, 0.0001);
+    EXPECT_ALMOST_EQ(summary.q3, 6.25, 0.0001);
+    EXPECT_ALMOST_EQ(summary.max, 8.0, 0.0001);
+
+    // Out of range percentile
+    errno = 0;
+    EXPECT_TRUE(isnan(stat_percentile_sorted_f(sorted, 8, 101.0)));
+    EXPECT_EQ(errno, EDOM);
+}
+
+TEST(test_percentiles_counting_i) {
+    // Narrow range (counting path) and wide range (sort path) must agree
+    const stat_int_t narrow[] = {7, 3, 3, 9, 5, 5, 5, 1, 8, 2};
+    const stat_int_t wide[] = {700000, 3, 3, 9, 5, 5, 5, 1, 8, -900000};
+    const stat_float_t centiles[] = {75.0, 10.0, 50.0};
+    stat_float_t results[3];
+
+    EXPECT_ALMOST_EQ(stat_percentile_i(narrow, 10, 0.0), 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_percentile_i(narrow, 10, 100.0), 9.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_percentile_i(narrow, 10, 50.0), 5.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_percentile_i(narrow, 10, 10.0), 1.9, 0.0001);
+    EXPECT_ALMOST_EQ(stat_percentile_i(wide, 10, 50.0), 5.0, 0.0001);
+
+    // Results follow ascending percentile order
+    stat_percentiles_array_i(narrow, 10, centiles, results, 3);
+    EXPECT_ALMOST_EQ(results[0], 1.9, 0.0001);
+    EXPECT_ALMOST_EQ(results[1], 5.0, 0.0001);
+    EXPECT_ALMOST_EQ(results[2], 6.5, 0.0001);
+
+    stat_five_num_summary_t summary = stat_five_num_summary_i(narrow, 10);
+    EXPECT_ALMOST_EQ(summary.min, 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(summary.q1, 3.0, 0.0001);
+    EXPECT_ALMOST_EQ(summary.median, 5.0, 0.0001);
+    EXPECT_ALMOST_EQ(summary.q3, 6.5, 0.0001);
+    EXPECT_ALMOST_EQ(summary.max, 9.0, 0.0001);
+
+    // Either side of the span limit: the widest counted span, then one value more
+    static stat_int_t ramp[STAT_COUNTING_MAX_SPAN + 1];
+    for (stat_size_t i = 0; i <= STAT_COUNTING_MAX_SPAN; i++) {
+        ramp[i] = (stat_int_t)i;
+    }
+    EXPECT_ALMOST_EQ(stat_percentile_i(ramp, STAT_COUNTING_MAX_SPAN, 50.0),
+                     (STAT_COUNTING_MAX_SPAN - 1) / 2.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_percentile_i(ramp, STAT_COUNTING_MAX_SPAN + 1, 50.0),
+                     STAT_COUNTING_MAX_SPAN / 2.0, 0.0001);
+    summary = stat_five_num_summary_i(ramp, STAT_COUNTING_MAX_SPAN);
+    EXPECT_ALMOST_EQ(summary.max, (STAT_COUNTING_MAX_SPAN - 1.0), 0.0001);
+}
+
+// =============================================
+// DATASET Test Cases
+// =============================================
+
+TEST(test_dataset_cache) {
+    const stat_float_t data[] = {4.0, 1.0, 3.0, 3.0, 2.0, 5.0};
+    stat_float_t workspace[6];
+    stat_float_t modes[6];
+    stat_size_t mode_count = 0;
+    stat_dataset_t ds;
+
+    stat_dataset_init(&ds, data, 6, workspace);
+    EXPECT_FALSE(ds.has_sorted);
+    EXPECT_ALMOST_EQ(stat_dataset_mean(&ds), 3.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_dataset_variance(&ds), 2.0, 0.0001);
+    EXPECT_FALSE(ds.has_sorted); // moments never sort
+
+    EXPECT_ALMOST_EQ(stat_dataset_median(&ds), 3.0, 0.0001);
+    EXPECT_TRUE(ds.has_sorted);
+    EXPECT_TRUE(ds.sorted == workspace); // caller workspace reused, nothing allocated
+    EXPECT_ALMOST_EQ(stat_dataset_interquartile_range(&ds), 1.5, 0.0001);
+    EXPECT_TRUE(stat_dataset_mode(&ds, modes, &mode_count));
+    EXPECT_EQ(mode_count, 1);
+    EXPECT_ALMOST_EQ(modes[0], 3.0, 0.0001);
+
+    stat_summary_t summary = stat_dataset_describe(&ds);
+    EXPECT_EQ(summary.count, 6);
+    EXPECT_ALMOST_EQ(summary.min, 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(summary.max, 5.0, 0.0001);
+    EXPECT_ALMOST_EQ(summary.q25, 2.25, 0.0001);
+    EXPECT_ALMOST_EQ(summary.q75, 3.75, 0.0001);
+    stat_dataset_free(&ds);
+}
+
+// =============================================
+// BINNING Test Cases
+// =============================================
+
+TEST(test_binning_edges) {
+    stat_float_t linear_edges[5] = {0.0, 1.0, 2.0, 3.0, 4.0};
+    stat_float_t custom_edges[5] = {0.0, 1.0, 10.0, 100.0, 1000.0};
+    stat_binning_config_t linear = {0.0, 4.0, 4, linear_edges, BIN_LINEAR, 0};
+    stat_binning_config_t custom = {0.0, 1000.0, 4, custom_edges, BIN_LINEAR, 0};
+    const stat_float_t values[] = {0.0, 0.5, 1.0, 2.5, 3.999, 4.0, 9.99, 10.0, 999.0, -1.0, 2000.0};
+    const stat_int_t ints[] = {0, 1, 5, 50, 500, 1000};
+
+    stat_size_t bins[4] = {0};
+    errno = 0;
+    stat_bin_values_f(values, 9, &linear, bins, 0);
+    EXPECT_EQ(bins[0], 2);
+    EXPECT_EQ(bins[1], 1);
+    EXPECT_EQ(bins[2], 1);
+    EXPECT_EQ(bins[3], 2); // last bin is closed on the right
+    EXPECT_EQ(errno, ERANGE); // 9.99, 10.0 and 999.0 are above the edges
+
+    // Non-uniform edges are honoured, not assumed linear
+    stat_size_t custom_bins[4] = {0};
+    errno = 0;
+    stat_bin_values_f(values, 11, &custom, custom_bins, 0);
+    EXPECT_EQ(custom_bins[0], 2);
+    EXPECT_EQ(custom_bins[1], 5);
+    EXPECT_EQ(custom_bins[2], 1);
+    EXPECT_EQ(custom_bins[3], 1);
+    EXPECT_EQ(errno, ERANGE); // -1.0 and 2000.0 skipped
+
+    stat_size_t int_bins[4] = {0};
+    stat_bin_values_i(ints, 6, &custom, int_bins);
+    EXPECT_EQ(int_bins[0], 1);
+    EXPECT_EQ(int_bins[1], 2);
+    EXPECT_EQ(int_bins[2], 1);
+    EXPECT_EQ(int_bins[3], 2);
+
+    // Digitize agrees with the counts and marks out-of-range values
+    uint8_t idx[11];
+    stat_size_t dig_bins[4] = {0};
+    stat_digitize_f(values, 11, &custom, idx, STAT_INDEX_U8, dig_bins, 0);
+    EXPECT_EQ(idx[0], 0);
+    EXPECT_EQ(idx[2], 1);
+    EXPECT_EQ(idx[7], 2);
+    EXPECT_EQ(idx[8], 3);
+    EXPECT_EQ(idx[9], UINT8_MAX);
+    EXPECT_EQ(dig_bins[1], custom_bins[1]);
+
+    // Epsilon snaps values just below an edge into the upper bin
+    stat_size_t eps_bins[4] = {0};
+    const stat_float_t near_edge[] = {0.9999999, 4.0000001};
+    stat_bin_values_f(near_edge, 2, &linear, eps_bins, 1e-6);
+    EXPECT_EQ(eps_bins[1], 1);
+    EXPECT_EQ(eps_bins[3], 1);
+}
+
+TEST(test_binning_digitize_widths) {
+    stat_float_t edges[5] = {0.0, 1.0, 10.0, 100.0, 1000.0};
+    stat_binning_config_t cfg = {0.0, 1000.0, 4, edges, BIN_LINEAR, 0};
+    const stat_float_t values[] = {0.0, 5.0, 50.0, 500.0, 1000.0, -1.0, 2000.0};
+    const stat_int_t ints[] = {0, 5, 50, 500, 1000, -1, 2000};
+    const uint32_t expected[] = {0, 1, 2, 3, 3};
+
+    uint16_t idx16[7], int16[7];
+    uint32_t idx32[7], int32[7];
+    stat_size_t bins16[4] = {0}, bins32[4] = {0};
+
+    errno = 0;
+    EXPECT_TRUE(stat_digitize_f(values, 7, &cfg, idx16, STAT_INDEX_U16, bins16, 0) == idx16);
+    EXPECT_EQ(errno, ERANGE);
+    errno = 0;
+    EXPECT_TRUE(stat_digitize_f(values, 7, &cfg, idx32, STAT_INDEX_U32, bins32, 0) == idx32);
+    EXPECT_EQ(errno, ERANGE);
+    errno = 0;
+    EXPECT_TRUE(stat_digitize_i(ints, 7, &cfg, int16, STAT_INDEX_U16, NULL) == int16);
+    EXPECT_EQ(errno, ERANGE);
+    stat_digitize_i(ints, 7, &cfg, int32, STAT_INDEX_U32, NULL);
+
+    for (stat_size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(idx16[i], expected[i]);
+        EXPECT_EQ(idx32[i], expected[i]);
+        EXPECT_EQ(int16[i], expected[i]);
+        EXPECT_EQ(int32[i], expected[i]);
+    }
+    // Out of range on either side gets the all-ones marker of the width
+    for (stat_size_t i = 5; i < 7; i++) {
+        EXPECT_EQ(idx16[i], UINT16_MAX);
+        EXPECT_EQ(idx32[i], UINT32_MAX);
+        EXPECT_EQ(int16[i], UINT16_MAX);
+        EXPECT_EQ(int32[i], UINT32_MAX);
+    }
+    EXPECT_EQ(bins16[3], 2);
+    EXPECT_EQ(bins32[3], 2);
+
+    // Integer edges compare exactly, without an epsilon
+    uint8_t int8[7];
+    stat_digitize_i(ints, 7, &cfg, int8, STAT_INDEX_U8, NULL);
+    EXPECT_EQ(int8[1], 1);
+    EXPECT_EQ(int8[6], UINT8_MAX);
+
+    // An index past 255 only fits the wider types
+    static stat_float_t wide_edges[301];
+    stat_binning_config_t wide = {0};
+    wide.min = 0.0;
+    wide.max = 300.0;
+    wide.count = 300;
+    wide.edges = wide_edges;
+    stat_binning_calculate_edges(&wide, BIN_LINEAR);
+    const stat_float_t high[] = {299.5, 256.0};
+    stat_digitize_f(high, 2, &wide, idx16, STAT_INDEX_U16, NULL, 0);
+    EXPECT_EQ(idx16[0], 299);
+    EXPECT_EQ(idx16[1], 256);
+}
+
+TEST(test_binning_parallel) {
+    stat_float_t edges[8];
+    stat_binning_config_t cfg = {0};
+    cfg.min = 0.0;
+    cfg.max = 10.0;
+    cfg.count = 7;
+    cfg.edges = edges;
+    stat_binning_calculate_edges(&cfg, BIN_LINEAR);
+
+    // 1001 values spread over [-1, 11): some fall outside on both sides
+    static stat_float_t values[1001];
+    static stat_int_t ints[1001];
+    for (stat_size_t i = 0; i < 1001; i++) {
+        values[i] = fmod(i * 0.7317, 12.0) - 1.0;
+        ints[i] = (stat_int_t)((i * 7) % 13) - 1;
+    }
+
+    stat_size_t serial[7] = {0}, serial_i[7] = {0};
+    errno = 0;
+    stat_bin_values_f(values, 1001, &cfg, serial, 0);
+    EXPECT_EQ(errno, ERANGE);
+    stat_bin_values_i(ints, 1001, &cfg, serial_i);
+
+    stat_size_t workspace[256];
+    const stat_size_t threads[] = {1, 3, 4}; // 3 and 4 leave a short last shard
+    for (stat_size_t t = 0; t < 3; t++) {
+        EXPECT_LTE(stat_bin_workspace_size(&cfg, threads[t]), 256);
+        EXPECT_GTE(stat_bin_workspace_size(&cfg, threads[t]), cfg.count * threads[t]);
+
+        stat_size_t bins[7] = {0}, bins_i[7] = {0};
+        errno = 0;
+        stat_bin_values_parallel_f(values, 1001, &cfg, bins, 0, threads[t], workspace);
+        EXPECT_EQ(errno, ERANGE);
+        errno = 0;
+        stat_bin_values_parallel_i(ints, 1001, &cfg, bins_i, threads[t], workspace);
+        EXPECT_EQ(errno, ERANGE);
+        for (stat_size_t b = 0; b < 7; b++) {
+            EXPECT_EQ(bins[b], serial[b]);
+            EXPECT_EQ(bins_i[b], serial_i[b]);
+        }
+    }
+
+    // All in range: no ERANGE, and counts are added to the caller's bins
+    stat_size_t bins[7] = {0};
+    errno = 0;
+    stat_bin_values_parallel_f(edges, 8, &cfg, bins, 0, 3, workspace);
+    EXPECT_EQ(errno, 0);
+    stat_bin_values_parallel_f(edges, 8, &cfg, bins, 0, 3, workspace);
+    EXPECT_EQ(bins[0], 2);
+    EXPECT_EQ(bins[6], 4); // edges[6] and the closed right edge
+}
+
+TEST(test_binning_log2) {
+    stat_float_t edges[8];
+    stat_binning_config_t cfg = {0};
+    cfg.min = 1.0;
+    cfg.max = 8.0;
+    cfg.sub_buckets = 2; // half-octave bins
+    cfg.count = stat_binning_log2_count(cfg.min, cfg.max, cfg.sub_buckets);
+    cfg.edges = edges;
+    EXPECT_EQ(cfg.count, 7);
+
+    stat_binning_calculate_edges(&cfg, BIN_LOG2);
+    EXPECT_EQ(cfg.strategy, BIN_LOG2);
+    EXPECT_ALMOST_EQ(edges[1], 1.5, 0.0001);
+    EXPECT_ALMOST_EQ(edges[4], 4.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[7], 12.0, 0.0001);
+
+    const stat_float_t values[] = {1.0, 1.49, 1.5, 2.0, 5.9, 6.0, 8.0, 12.0, 0.5, -3.0};
+    stat_size_t bins[7] = {0};
+    errno = 0;
+    stat_bin_values_f(values, 10, &cfg, bins, 0);
+    EXPECT_EQ(bins[0], 2);
+    EXPECT_EQ(bins[1], 1);
+    EXPECT_EQ(bins[2], 1);
+    EXPECT_EQ(bins[4], 1);
+    EXPECT_EQ(bins[5], 1);
+    EXPECT_EQ(bins[6], 2); // last bin is closed on the right
+    EXPECT_EQ(errno, ERANGE); // 0.5 and -3.0 below the first edge
+
+    // A hand-built config with a stale BIN_LOG2 tag but linear edges is searched, not keyed
+    stat_float_t linear_edges[5] = {1.0, 3.0, 5.0, 7.0, 9.0};
+    stat_binning_config_t stale = {1.0, 9.0, 4, linear_edges, BIN_LOG2, 2};
+    const stat_float_t mid[] = {1.5, 2.9, 3.0, 4.5, 6.0, 8.9, 9.0};
+    stat_size_t stale_bins[4] = {0};
+    stat_bin_values_f(mid, 7, &stale, stale_bins, 0);
+    EXPECT_EQ(stale_bins[0], 2);
+    EXPECT_EQ(stale_bins[1], 2);
+    EXPECT_EQ(stale_bins[2], 1);
+    EXPECT_EQ(stale_bins[3], 2);
+
+    // Garbage sub_buckets (not a power of two) does not trip the key path either
+    stale.sub_buckets = 3;
+    memset(stale_bins, 0, sizeof(stale_bins));
+    stat_bin_values_f(mid, 7, &stale, stale_bins, 0);
+    EXPECT_EQ(stale_bins[1], 2);
+}
+
+TEST(test_binning_2d) {
+    stat_float_t x_edges[5], y_edges[3];
+    stat_binning_config_t x_cfg = {0}, y_cfg = {0};
+    x_cfg.min = 0.0; x_cfg.max = 4.0; x_cfg.count = 4; x_cfg.edges = x_edges;
+    y_cfg.min = 0.0; y_cfg.max = 2.0; y_cfg.count = 2; y_cfg.edges = y_edges;
+    stat_binning_calculate_edges(&x_cfg, BIN_LINEAR);
+    stat_binning_calculate_edges(&y_cfg, BIN_LINEAR);
+
+    const stat_float_t xs[] = {0.5, 3.5, 3.9, 1.2, 4.0, 9.0};
+    const stat_float_t ys[] = {0.5, 1.5, 1.1, 0.2, 2.0, 1.0};
+    stat_size_t counts[8] = {0};
+    errno = 0;
+    stat_bin_values_2d_f(xs, ys, 6, &x_cfg, &y_cfg, counts, 0);
+    EXPECT_EQ(counts[0], 1);     // (0.5, 0.5)
+    EXPECT_EQ(counts[1], 1);     // (1.2, 0.2)
+    EXPECT_EQ(counts[4 + 3], 3); // top right, right/top edges closed
+    EXPECT_EQ(errno, ERANGE);    // x = 9.0 skipped
+
+    stat_size_t workspace[64];
+    stat_size_t par[8] = {0};
+    EXPECT_TRUE(stat_bin2d_workspace_size(&x_cfg, &y_cfg, 2) <= 64);
+    stat_bin_values_2d_parallel_f(xs, ys, 6, &x_cfg, &y_cfg, par, 0, 2, workspace);
+    EXPECT_EQ(memcmp(par, counts, sizeof(counts)), 0);
+
+    stat_size_t x_bins[4], y_bins[2];
+    stat_bin2d_marginal_x(counts, &x_cfg, &y_cfg, x_bins);
+    stat_bin2d_marginal_y(counts, &x_cfg, &y_cfg, y_bins);
+    EXPECT_EQ(x_bins[3], 3);
+    EXPECT_EQ(y_bins[0], 2);
+    EXPECT_EQ(y_bins[1], 3);
+}
+
+TEST(test_stream_hist) {
+    stat_stream_bin_t storage_a[STAT_STREAM_HIST_STORAGE(4)];
+    stat_stream_bin_t storage_b[STAT_STREAM_HIST_STORAGE(4)];
+    stat_stream_hist_t a, b;
+    stat_stream_hist_init(&a, storage_a, 4);
+    stat_stream_hist_init(&b, storage_b, 4);
+
+    const stat_float_t left[] = {1.0, 2.0, 2.0, 3.0, 10.0};
+    const stat_float_t right[] = {11.0, 12.0, 30.0};
+    stat_stream_hist_add_array_f(&a, left, 5);
+    EXPECT_EQ(a.count, 4);             // repeated 2.0 shares a centroid
+    stat_stream_hist_add_array_f(&b, right, 3);
+    stat_stream_hist_merge(&a, &b);
+    EXPECT_EQ(a.count, 4);
+    EXPECT_EQ(a.total, 8);
+    EXPECT_ALMOST_EQ(a.min, 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(a.max, 30.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_stream_hist_sum(&a, 0.0), 0.0, 0.0001);
+    EXPECT_ALMOST_EQ(stat_stream_hist_sum(&a, 30.0), 8.0, 0.0001);
+
+    stat_float_t edges[4];
+    stat_size_t bins[3];
+    stat_binning_config_t cfg = {0};
+    cfg.count = 3;
+    cfg.edges = edges;
+    stat_stream_hist_export(&a, &cfg, bins);
+    EXPECT_ALMOST_EQ(edges[0], 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[3], 30.0, 0.0001);
+    EXPECT_EQ(bins[0] + bins[1] + bins[2], 8);
+    EXPECT_TRUE(bins[0] > bins[2]);
+}
+
+TEST(test_binning_rules) {
+    const stat_float_t values[] = {4.0, 1.0, 9.0, 2.0, 7.0, 3.0, 8.0, 5.0, 6.0, 10.0};
+    stat_float_t workspace[10];
+
+    EXPECT_EQ(stat_bin_count_f(values, 10, BIN_RULE_STURGES, NULL), 5);
+    EXPECT_EQ(stat_bin_count_f(values, 10, BIN_RULE_SCOTT, NULL), 2);
+    EXPECT_EQ(stat_bin_count_f(values, 10, BIN_RULE_FREEDMAN_DIACONIS, workspace), 3);
+    EXPECT_EQ(stat_bin_count_f(values, 10, BIN_RULE_DOANE, NULL), 5); // symmetric: no skew term
+
+    // Selection-based quartiles match the sorted ones
+    memcpy(workspace, values, sizeof(values));
+    EXPECT_ALMOST_EQ(stat_percentile_select_f(workspace, 10, 25.0), 3.25, 0.0001);
+    EXPECT_ALMOST_EQ(stat_percentile_select_f(workspace, 10, 75.0), 7.75, 0.0001);
+
+    stat_binning_config_t cfg = {0};
+    EXPECT_TRUE(stat_auto_bin_rule_f(values, 10, &cfg, BIN_RULE_STURGES, workspace, 10) != NULL);
+    EXPECT_EQ(cfg.count, 5);
+    EXPECT_TRUE(cfg.edges == workspace);
+    EXPECT_ALMOST_EQ(cfg.edges[0], 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(cfg.edges[5], 10.0, 0.0001);
+}
+
+TEST(test_binning_equal_frequency) {
+    const stat_float_t values[] = {9.0, 1.0, 8.0, 2.0, 7.0, 3.0, 6.0, 4.0, 5.0};
+    stat_float_t workspace[9];
+    stat_float_t edges[5];
+    stat_binning_config_t cfg = {0};
+    cfg.count = 4;
+    cfg.edges = edges;
+
+    EXPECT_TRUE(stat_bin_equal_frequency_f(values, 9, &cfg, workspace) != NULL);
+    EXPECT_EQ(cfg.strategy, BIN_PERCENTILE);
+    EXPECT_ALMOST_EQ(edges[0], 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[1], 3.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[2], 5.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[3], 7.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[4], 9.0, 0.0001);
+
+    cfg.count = 3; // cuts at ranks 2.67 and 5.33 interpolate
+    stat_bin_equal_frequency_f(values, 9, &cfg, workspace);
+    EXPECT_ALMOST_EQ(edges[1], 11.0 / 3.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[2], 19.0 / 3.0, 0.0001);
+}
+
+TEST(test_binning_natural) {
+    // Three obvious clusters
+    const stat_float_t values[] = {21.0, 1.0, 11.0, 2.0, 22.0, 1.5, 12.0, 20.5, 10.0};
+    stat_float_t workspace[5 * 9 + 2];
+    stat_size_t splits[9 * 3];
+    stat_float_t edges[4];
+    stat_binning_config_t cfg = {0};
+    cfg.count = 3;
+    cfg.edges = edges;
+
+    EXPECT_EQ(stat_bin_natural_workspace_size(9), 5 * 9 + 2);
+    EXPECT_TRUE(stat_bin_natural_f(values, 9, &cfg, workspace, splits) != NULL);
+    EXPECT_EQ(cfg.strategy, BIN_NATURAL);
+    EXPECT_ALMOST_EQ(edges[0], 1.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[1], 10.0, 0.0001);
+    EXPECT_ALMOST_EQ(edges[2], 20.5, 0.0001);
+    EXPECT_ALMOST_EQ(edges[3], 22.0, 0.0001);
+
+    stat_size_t bins[3] = {0};
+    stat_bin_values_f(values, 9, &cfg, bins, 0);
+    EXPECT_EQ(bins[0], 3);
+    EXPECT_EQ(bins[1], 3);
+    EXPECT_EQ(bins[2], 3);
+
+    errno = 0;
+    cfg.count = 3;
+    EXPECT_TRUE(stat_bin_natural_f(values, 2, &cfg, workspace, splits) == NULL);
+    EXPECT_EQ(errno, EINVAL);
+}
+
 // =============================================
 // BASIC Test Cases
 // =============================================
@@ -250,4 +736,251 @@ TEST(test_basic_error_handling) {
 }
 */
 
+// =============================================
+// DISTRIBUTIONS Test Cases
+// =============================================
+
+TEST(test_dist_ziggurat_tables) {
+    // Marsaglia & Tsang (2000): tail start r and the common layer area v
+    const double r = 3.442619855899;
+    const double v = 9.91256303526217e-3;
+    const double two24 = 16777216.0;
+
+    const stat_zig_layer_t base = stat_ziggurat_layer(0);
+    const stat_zig_layer_t widest = stat_ziggurat_layer(STAT_ZIGGURAT_LAYERS - 1);
+    EXPECT_ALMOST_EQ(widest.x, (r), 1e-12);
+    EXPECT_ALMOST_EQ(widest.f, (exp(-0.5 * r * r)), 1e-15);
+    EXPECT_ALMOST_EQ(base.x, (v / exp(-0.5 * r * r)), 1e-12);
+    EXPECT_EQ(base.f, 1.0);
+    EXPECT_EQ(base.k, (uint32_t)(r / base.x * two24));
+    EXPECT_EQ(stat_ziggurat_layer(1).k, 0U);
+
+    // r closes the ziggurat: the base strip (rectangle plus Gaussian tail) has area v
+    EXPECT_ALMOST_EQ(r * exp(-0.5 * r * r) + sqrt(M_PI / 2.0) * erfc(r / sqrt(2.0)), (v), 1e-12);
+
+    // Rebuild every layer from the recurrence; a mistyped digit shows up here
+    double x = r;
+    for (stat_size_t i = STAT_ZIGGURAT_LAYERS - 1; i-- > 1;) {
+        const double next = sqrt(-2.0 * log(v / x + exp(-0.5 * x * x)));
+        const stat_zig_layer_t layer = stat_ziggurat_layer(i);
+        const uint32_t k = (uint32_t)(next / x * two24);
+        EXPECT_ALMOST_EQ(layer.x, (next), 1e-12);
+        EXPECT_ALMOST_EQ(layer.f, (exp(-0.5 * next * next)), 1e-15);
+        EXPECT_LTE(stat_ziggurat_layer(i + 1).k - (k - 1), 2U); // k or k +- 1 from rounding
+        x = next;
+    }
+    // ...and the top layer, x[1] wide and 1 - f(x[1]) tall, has area v too
+    EXPECT_ALMOST_EQ(x * (1.0 - exp(-0.5 * x * x)), (v), 1e-9);
+}
+
+TEST(test_dist_normal_methods) {
+    const stat_normal_method_t methods[] = {STAT_NORMAL_BOX_MULLER, STAT_NORMAL_POLAR, STAT_NORMAL_ZIGGURAT};
+    const stat_size_t chunk = 499; // odd: covers the unpaired last value
+    const stat_size_t rounds = 400;
+    const double n = (double)chunk * rounds;
+    const double r = 3.442619855899;
+    const double p2 = erfc(2.0 / sqrt(2.0));  // P(|z| > 2)
+    const double pr = erfc(r / sqrt(2.0));    // P(|z| > r), the ziggurat tail
+    stat_float_t samples[499];
+
+    for (stat_size_t m = 0; m < 3; m++) {
+        prng_state_t rng;
+        prng_init(&rng, PRNG_PCG32, 0x5EED + m, 0, NULL);
+
+        double sum = 0.0, sum_sq = 0.0;
+        stat_size_t beyond2 = 0, beyond_r = 0;
+        for (stat_size_t c = 0; c < rounds; c++) {
+            stat_generate_normal_dist_ex(samples, chunk, 0.0, 1.0, methods[m], &rng);
+            for (stat_size_t i = 0; i < chunk; i++) {
+                sum += samples[i];
+                sum_sq += samples[i] * samples[i];
+                beyond2 += fabs(samples[i]) > 2.0;
+                beyond_r += fabs(samples[i]) > r;
+            }
+        }
+
+        // All bounds are 4 standard errors of the estimate
+        const double mean = sum / n;
+        const double var = sum_sq / n - mean * mean;
+        EXPECT_LT(fabs(mean), 4.0 / sqrt(n));
+        EXPECT_LT(fabs(var - 1.0), 4.0 * sqrt(2.0 / n));
+        EXPECT_LT(fabs(beyond2 / n - p2), 4.0 * sqrt(p2 * (1.0 - p2) / n));
+        EXPECT_LT(fabs(beyond_r / n - pr), 4.0 * sqrt(pr * (1.0 - pr) / n));
+    }
+
+    // Location and scale are applied after sampling
+    prng_state_t rng;
+    prng_init(&rng, PRNG_PCG32, 0x5EED, 0, NULL);
+    stat_generate_normal_dist_ex(samples, chunk, 10.0, 0.0, STAT_NORMAL_ZIGGURAT, &rng);
+    EXPECT_EQ(samples[0], 10.0);
+    errno = 0;
+    stat_generate_normal_dist_ex(samples, chunk, 0.0, -1.0, STAT_NORMAL_POLAR, &rng);
+    EXPECT_EQ(errno, EINVAL);
+}
+
+// Discrete goodness of fit: cell 0 holds k <= lo, the last cell k >= lo + bins - 1
+typedef double (*test_pmf_t)(double k, double a, double b);
+
+static double test_poisson_pmf(double k, double lambda, double unused) {
+    (void)unused;
+    return exp(k * log(lambda) - lambda - lgamma(k + 1.0));
+}
+
+static double test_binomial_pmf(double k, double trials, double p) {
+    if (k > trials) {
+        return 0.0;
+    }
+    return exp(lgamma(trials + 1.0) - lgamma(k + 1.0) - lgamma(trials - k + 1.0) +
+               k * log(p) + (trials - k) * log(1.0 - p));
+}
+
+static void test_discrete_tally(const stat_size_t* samples, stat_size_t count, stat_size_t lo, stat_size_t bins,
+                                stat_size_t* cells, double* sum, double* sum_sq) {
+    for (stat_size_t i = 0; i < count; i++) {
+        const stat_size_t k = samples[i];
+        cells[k <= lo ? 0 : (k - lo >= bins - 1 ? bins - 1 : k - lo)]++;
+        *sum += k;
+        *sum_sq += (double)k * k;
+    }
+}
+
+// Pearson chi-square, adjacent cells merged until each expects >= 5, as standard
+// deviations above its mean: (chi2 - dof) / sqrt(2 dof)
+static double test_discrete_chi2_z(const stat_size_t* cells, stat_size_t lo, stat_size_t bins, double n,
+                                   test_pmf_t pmf, double a, double b) {
+    double below = 0.0;
+    for (stat_size_t k = 0; k <= lo; k++) {
+        below += pmf((double)k, a, b);
+    }
+
+    double chi2 = 0.0, obs = 0.0, exp_n = 0.0, last_obs = 0.0, last_exp = 0.0, covered = 0.0;
+    stat_size_t merged = 0;
+    for (stat_size_t j = 0; j < bins; j++) {
+        double p = (j == 0) ? below : pmf((double)(lo + j), a, b);
+        if (j == bins - 1) {
+            p = 1.0 - covered; // upper tail
+        }
+        covered += p;
+        obs += cells[j];
+        exp_n += p * n;
+        if (exp_n >= 5.0) {
+            chi2 += (obs - exp_n) * (obs - exp_n) / exp_n;
+            last_obs = obs;
+            last_exp = exp_n;
+            merged++;
+            obs = exp_n = 0.0;
+        }
+    }
+    if (exp_n > 0.0) { // short tail: fold it into the last full cell
+        chi2 -= (last_obs - last_exp) * (last_obs - last_exp) / last_exp;
+        last_obs += obs;
+        last_exp += exp_n;
+        chi2 += (last_obs - last_exp) * (last_obs - last_exp) / last_exp;
+    }
+
+    const double dof = (double)merged - 1.0;
+    return (chi2 - dof) / sqrt(2.0 * dof);
+}
+
+TEST(test_dist_poisson) {
+    // Knuth's loop below STAT_POISSON_PTRS_MIN, PTRS from there up
+    const double lambdas[] = {3.5, STAT_POISSON_PTRS_MIN - 0.5, STAT_POISSON_PTRS_MIN,
+                              STAT_POISSON_PTRS_MIN + 0.5, 1000.0};
+    const stat_size_t chunk = 500;
+    const stat_size_t rounds = 40;
+    const double n = (double)chunk * rounds;
+    stat_size_t samples[500];
+    static stat_size_t cells[256];
+
+    for (stat_size_t l = 0; l < sizeof(lambdas) / sizeof(lambdas[0]); l++) {
+        const double lambda = lambdas[l];
+        const double sd = sqrt(lambda);
+        const stat_size_t lo = lambda > 4.0 * sd ? (stat_size_t)(lambda - 4.0 * sd) : 0;
+        stat_size_t bins = (stat_size_t)(8.0 * sd) + 3;
+        bins = bins > 256 ? 256 : bins;
+        memset(cells, 0, sizeof(cells));
+
+        prng_state_t rng;
+        prng_init(&rng, PRNG_PCG32, 0xF15 + l, 0, NULL);
+        double sum = 0.0, sum_sq = 0.0;
+        for (stat_size_t c = 0; c < rounds; c++) {
+            stat_generate_poisson_dist(samples, chunk, lambda, &rng);
+            test_discrete_tally(samples, chunk, lo, bins, cells, &sum, &sum_sq);
+        }
+
+        // Mean and variance within 4 standard errors (var of s^2 is (mu4 - sigma^4) / n)
+        const double mean = sum / n;
+        const double var = sum_sq / n - mean * mean;
+        EXPECT_LT(fabs(mean - lambda), 4.0 * sqrt(lambda / n));
+        EXPECT_LT(fabs(var - lambda), 4.0 * sqrt((lambda + 2.0 * lambda * lambda) / n));
+        EXPECT_LT(test_discrete_chi2_z(cells, lo, bins, n, test_poisson_pmf, lambda, 0.0), 4.0);
+    }
+
+    prng_state_t rng;
+    prng_init(&rng, PRNG_PCG32, 0xF15, 0, NULL);
+    errno = 0;
+    stat_generate_poisson_dist(samples, chunk, 0.0, &rng);
+    EXPECT_EQ(errno, EINVAL);
+}
+
+TEST(test_dist_binomial) {
+    // n * min(p, 1-p) either side of STAT_BINOMIAL_BTPE_MIN, directly and mirrored (p > 0.5)
+    const stat_size_t trials[] = {100, 100, 100, 100, 100, 10000};
+    const double probs[] = {(STAT_BINOMIAL_BTPE_MIN - 1.0) / 100.0, (STAT_BINOMIAL_BTPE_MIN + 1.0) / 100.0,
+                            1.0 - (STAT_BINOMIAL_BTPE_MIN - 1.0) / 100.0, 1.0 - (STAT_BINOMIAL_BTPE_MIN + 1.0) / 100.0,
+                            STAT_BINOMIAL_BTPE_MIN / 100.0, 0.4};
+    const stat_size_t chunk = 500;
+    const stat_size_t rounds = 40;
+    const double n = (double)chunk * rounds;
+    stat_size_t samples[500];
+    static stat_size_t cells[256];
+
+    for (stat_size_t c = 0; c < sizeof(probs) / sizeof(probs[0]); c++) {
+        const double t = (double)trials[c];
+        const double p = probs[c];
+        const double mu = t * p;
+        const double var_x = t * p * (1.0 - p);
+        const double sd = sqrt(var_x);
+        const stat_size_t lo = mu > 4.0 * sd ? (stat_size_t)(mu - 4.0 * sd) : 0;
+        stat_size_t bins = (stat_size_t)(8.0 * sd) + 3;
+        bins = bins > 256 ? 256 : bins;
+        memset(cells, 0, sizeof(cells));
+
+        prng_state_t rng;
+        prng_init(&rng, PRNG_PCG32, 0xB10 + c, 0, NULL);
+        double sum = 0.0, sum_sq = 0.0;
+        for (stat_size_t r = 0; r < rounds; r++) {
+            stat_generate_binomial_dist(samples, chunk, trials[c], p, &rng);
+            for (stat_size_t i = 0; i < chunk; i++) {
+                EXPECT_LTE(samples[i], trials[c]);
+            }
+            test_discrete_tally(samples, chunk, lo, bins, cells, &sum, &sum_sq);
+        }
+
+        // mu4 = npq (1 + 3 (n - 2) pq), so var of s^2 is (mu4 - (npq)^2) / n
+        const double mu4 = var_x * (1.0 + 3.0 * (t - 2.0) * p * (1.0 - p));
+        const double mean = sum / n;
+        const double var = sum_sq / n - mean * mean;
+        EXPECT_LT(fabs(mean - mu), 4.0 * sqrt(var_x / n));
+        EXPECT_LT(fabs(var - var_x), 4.0 * sqrt((mu4 - var_x * var_x) / n));
+        EXPECT_LT(test_discrete_chi2_z(cells, lo, bins, n, test_binomial_pmf, t, p), 4.0);
+    }
+
+    // Degenerate probabilities are exact
+    prng_state_t rng;
+    prng_init(&rng, PRNG_PCG32, 0xB10, 0, NULL);
+    stat_generate_binomial_dist(samples, chunk, 50, 0.0, &rng);
+    for (stat_size_t i = 0; i < chunk; i++) {
+        EXPECT_EQ(samples[i], 0);
+    }
+    stat_generate_binomial_dist(samples, chunk, 50, 1.0, &rng);
+    for (stat_size_t i = 0; i < chunk; i++) {
+        EXPECT_EQ(samples[i], 50);
+    }
+
+    errno = 0;
+    stat_generate_binomial_dist(samples, chunk, 50, 1.5, &rng);
+    EXPECT_EQ(errno, EINVAL);
+}
+
 #endif
@@ -169,7 +169,7 @@ static jmp_buf tdd_death_jmp_buf;
  */
 #define EXPECT_LT(a, b) _EXPECT_COMPARE(a, b, <, "LT")
 
-#define EXPECT_LTE(a,b) _EXPECT_COMPARE(c,b,<=,"LTE")
+#define EXPECT_LTE(a,b) _EXPECT_COMPARE(a,b,<=,"LTE")
 
 // =============================================
 // String Comparisons